@@ -0,0 +1,80 @@
+
+// Compares the cost of constructing and filling large heap-allocated buffers with value-initialized and default-initialized
+// elements, and of copying a buffer with uninitialized copy versus value initialization followed by assignment.
+//
+// Usage: bench-buffer-init [<number of elements>]
+
+
+#include <cstdio>
+#include <string>
+#include <cstddef>    // for size_t
+#include <algorithm>  // for copy()
+
+#include <makeshift/experimental/buffer.hpp>  // for buffer<>, default_init
+
+#include "bench-common.hpp"  // for measure_seconds(), report_bandwidth(), sink<>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+
+
+template <typename BufferT>
+void
+fill(BufferT& buf)
+{
+    for (std::size_t i = 0, n = buf.size(); i != n; ++i)
+    {
+        buf[i] = double(i);
+    }
+}
+
+
+} // anonymous namespace
+
+
+int
+main(int argc, char* argv[])
+{
+    std::size_t n = argc > 1 ? std::size_t(std::stoll(argv[1])) : std::size_t(1) << 23;
+    int numReps = 10;
+    double numBytes = double(sizeof(double)*n);
+
+    std::printf("n = %llu\n", static_cast<unsigned long long>(n));
+
+    bench::report_bandwidth("construct and fill, value-initialized",
+        bench::measure_seconds([&]
+        {
+            auto buf = mk::buffer<double>(n);
+            fill(buf);
+            bench::sink<double> = buf[n - 1];
+        }, numReps),
+        numBytes);
+    bench::report_bandwidth("construct and fill, default_init",
+        bench::measure_seconds([&]
+        {
+            auto buf = mk::buffer<double>(n, mk::default_init);
+            fill(buf);
+            bench::sink<double> = buf[n - 1];
+        }, numReps),
+        numBytes);
+
+    auto src = mk::buffer<double>(n, mk::default_init);
+    fill(src);
+    bench::report_bandwidth("copy, value initialization and copy()",
+        bench::measure_seconds([&]
+        {
+            auto buf = mk::buffer<double>(n);
+            std::copy(src.begin(), src.end(), buf.begin());
+            bench::sink<double> = buf[n - 1];
+        }, numReps),
+        numBytes);
+    bench::report_bandwidth("copy, copy constructor",
+        bench::measure_seconds([&]
+        {
+            auto buf = src;
+            bench::sink<double> = buf[n - 1];
+        }, numReps),
+        numBytes);
+}
@@ -0,0 +1,50 @@
+// Timing and reporting helpers shared by the benchmarks.
+
+
+#ifndef INCLUDED_MAKESHIFT_BENCH_COMMON_HPP_
+#define INCLUDED_MAKESHIFT_BENCH_COMMON_HPP_
+
+
+#include <chrono>
+#include <cstdio>
+
+
+namespace bench {
+
+
+    // Benchmarks store results to `sink<T>` to keep the compiler from eliminating the computations being measured.
+template <typename T> inline volatile T sink{ };
+
+    // Calls `func()` `numReps` times and returns the shortest runtime in seconds.
+template <typename F>
+double
+measure_seconds(F&& func, int numReps)
+{
+    auto best = std::chrono::duration<double>::max();
+    for (int rep = 0; rep < numReps; ++rep)
+    {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        if (end - start < best) best = end - start;
+    }
+    return best.count();
+}
+
+inline void
+report_bandwidth(char const* name, double seconds, double numBytes)
+{
+    std::printf("%-48s %9.3f ms %9.2f GB/s\n", name, seconds*1.e3, numBytes/seconds*1.e-9);
+}
+
+inline void
+report_time_per_item(char const* name, double seconds, double numItems, char const* itemName)
+{
+    std::printf("%-48s %9.3f ms %9.2f ns/%s\n", name, seconds*1.e3, seconds/numItems*1.e9, itemName);
+}
+
+
+} // namespace bench
+
+
+#endif // INCLUDED_MAKESHIFT_BENCH_COMMON_HPP_
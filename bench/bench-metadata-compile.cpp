@@ -0,0 +1,124 @@
+// Measures the compile-time cost of reflection metadata. The translation unit defines `MAKESHIFT_BENCH_NUM_TYPES` reflected
+// class types and as many reflected enums, and queries the values, members, names, and name lookup indices of every type.
+// The benchmark is the compilation itself; the resulting program merely prints a checksum.
+//
+// Usage: time cmake --build . --target bench-metadata-compile-100 bench-metadata-compile-1000
+
+
+#include <array>
+#include <cstdio>
+#include <cstddef>  // for size_t
+#include <utility>  // for pair<>, index_sequence<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>
+
+#include <makeshift/tuple.hpp>     // for value_tuple<>, make_value_tuple()
+#include <makeshift/metadata.hpp>  // for metadata::values<>(), metadata::members<>(), ...
+
+
+#ifndef MAKESHIFT_BENCH_NUM_TYPES
+# define MAKESHIFT_BENCH_NUM_TYPES 100
+#endif // MAKESHIFT_BENCH_NUM_TYPES
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+    // Every instance of `Types<I>` defines a distinct enum and distinct class types whose metadata is found by ADL through
+    // hidden friends, so the metadata of each type has to be computed separately.
+template <std::size_t I>
+struct Types
+{
+    enum class Color { red, green, blue, cyan, magenta, yellow };
+    friend constexpr auto
+    reflect(gsl::type_identity<Color>)
+    {
+        return mk::value_tuple{
+            "Color",
+            std::array{
+                std::pair{ Color::red, "red" },
+                std::pair{ Color::green, "green" },
+                std::pair{ Color::blue, "blue" },
+                std::pair{ Color::cyan, "cyan" },
+                std::pair{ Color::magenta, "magenta" },
+                std::pair{ Color::yellow, "yellow" }
+            }
+        };
+    }
+
+    struct Base
+    {
+        int id;
+        Color color;
+    };
+    friend constexpr auto
+    reflect(gsl::type_identity<Base>)
+    {
+        return mk::make_value_tuple(
+            mk::value_tuple{ &Base::id, "id", "identifier" },
+            mk::value_tuple{ &Base::color, "color", "color" });
+    }
+
+    struct Record : Base
+    {
+        double x, y, z;
+        float weight;
+        unsigned flags;
+    };
+    friend constexpr auto
+    reflect(gsl::type_identity<Record>)
+    {
+        return mk::value_tuple{
+            "Record",
+            mk::value_tuple{ gsl::type_identity<Base>{ } },
+            mk::make_value_tuple(
+                mk::value_tuple{ &Record::x, "x", "x coordinate" },
+                mk::value_tuple{ &Record::y, "y", "y coordinate" },
+                mk::value_tuple{ &Record::z, "z", "z coordinate" },
+                mk::value_tuple{ &Record::weight, "weight", "statistical weight" },
+                mk::value_tuple{ &Record::flags, "flags", "flags" })
+        };
+    }
+};
+
+template <std::size_t I>
+constexpr std::size_t
+query_metadata(void)
+{
+    using Color = typename Types<I>::Color;
+    using Record = typename Types<I>::Record;
+
+    std::size_t result = 0;
+    result += mk::metadata::values<Color>().size();
+    result += mk::metadata::value_names<Color>().size();
+    result += std::size_t(mk::metadata::search_value_index_by_name<Color>("cyan"));
+    result += mk::metadata::name<Color>().size();
+    result += std::tuple_size<std::remove_const_t<std::remove_reference_t<decltype(mk::metadata::members<Record>())>>>::value;
+    result += mk::metadata::member_names<Record>().size();
+    result += mk::metadata::exclusive_member_names<Record>().size();
+    result += mk::metadata::member_descriptions<Record>().size();
+    result += std::size_t(mk::metadata::search_member_index_by_name<Record>("weight"));
+    result += std::tuple_size<decltype(mk::metadata::bases<Record>())>::value;
+    return result;
+}
+
+template <std::size_t... Is>
+constexpr std::size_t
+query_all_metadata(std::index_sequence<Is...>)
+{
+    return (std::size_t(0) + ... + query_metadata<Is>());
+}
+
+
+} // anonymous namespace
+
+
+int
+main(void)
+{
+    constexpr std::size_t checksum = query_all_metadata(std::make_index_sequence<MAKESHIFT_BENCH_NUM_TYPES>{ });
+    std::printf("%d types, checksum %zu\n", MAKESHIFT_BENCH_NUM_TYPES, checksum);
+}
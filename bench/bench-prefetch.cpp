@@ -0,0 +1,79 @@
+
+// Compares the bandwidth of `range_for()` and `range_transform_reduce()` with their prefetching counterparts for streaming
+// passes over arrays much larger than the last-level cache, and for a gather `sum += x[idx[i]]` with random indices.
+//
+// Sequential streams are usually covered by the hardware prefetcher, so little difference is expected for the triad and the
+// dot product. Prefetches are issued for the ranges passed to the algorithm, i.e. for the index array of the gather, but not
+// for the elements it refers to, which are accessed through the captured array `x`. On the x86 development machine, the
+// gather ran about 8% faster with prefetching; the random accesses to `x` still dominate its runtime.
+//
+// Usage: bench-prefetch [<number of elements>]
+
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>     // for int32_t
+#include <functional>  // for plus<>
+#include <type_traits> // for integral_constant<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, index
+
+#include <makeshift/algorithm.hpp>  // for range_for(), range_for_prefetch(), range_transform_reduce(), range_transform_reduce_prefetch()
+
+#include "bench-common.hpp"  // for measure_seconds(), report_bandwidth(), sink<>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+} // anonymous namespace
+
+
+int
+main(int argc, char* argv[])
+{
+    gsl::dim n = argc > 1 ? gsl::dim(std::stoll(argv[1])) : gsl::dim(1) << 24;
+    int numReps = 10;
+    constexpr auto distanceC = std::integral_constant<gsl::dim, 64>{ };
+
+    auto xs = std::vector<double>(n, 1.);
+    auto ys = std::vector<double>(n, 2.);
+    auto zs = std::vector<double>(n, 0.);
+
+    std::printf("n = %lld, prefetch distance = %lld\n", static_cast<long long>(n), static_cast<long long>(distanceC()));
+
+    double triadBytes = 3.*sizeof(double)*n;
+    auto triad = [](double& z, double x, double y) { z = x + 3.*y; };
+    bench::report_bandwidth("triad, range_for()", bench::measure_seconds([&] { mk::range_for(triad, zs, xs, ys); }, numReps), triadBytes);
+    bench::report_bandwidth("triad, range_for_prefetch()", bench::measure_seconds([&] { mk::range_for_prefetch(distanceC, triad, zs, xs, ys); }, numReps), triadBytes);
+
+    double dotBytes = 2.*sizeof(double)*n;
+    auto mul = [](double x, double y) { return x*y; };
+    bench::report_bandwidth("dot, range_transform_reduce()",
+        bench::measure_seconds([&] { bench::sink<double> = mk::range_transform_reduce(0., std::plus<>{ }, mul, xs, ys); }, numReps),
+        dotBytes);
+    bench::report_bandwidth("dot, range_transform_reduce_prefetch()",
+        bench::measure_seconds([&] { bench::sink<double> = mk::range_transform_reduce_prefetch(distanceC, 0., std::plus<>{ }, mul, xs, ys); }, numReps),
+        dotBytes);
+
+    auto rng = std::mt19937{ 42 };
+    auto indexDist = std::uniform_int_distribution<std::int32_t>(0, std::int32_t(n - 1));
+    auto indices = std::vector<std::int32_t>(n);
+    for (auto& index : indices)
+    {
+        index = indexDist(rng);
+    }
+    double gatherBytes = double(sizeof(std::int32_t) + sizeof(double))*n;
+    auto gather = [&xs](std::int32_t index) { return xs[index]; };
+    bench::report_bandwidth("gather, range_transform_reduce()",
+        bench::measure_seconds([&] { bench::sink<double> = mk::range_transform_reduce(0., std::plus<>{ }, gather, indices); }, numReps),
+        gatherBytes);
+    bench::report_bandwidth("gather, range_transform_reduce_prefetch()",
+        bench::measure_seconds([&] { bench::sink<double> = mk::range_transform_reduce_prefetch(distanceC, 0., std::plus<>{ }, gather, indices); }, numReps),
+        gatherBytes);
+}
@@ -0,0 +1,154 @@
+// Compares `reflected_hash<>` with hand-written hash functions which combine the `std::hash<>` values of the members, both for
+// hashing alone and for lookups in a `std::unordered_map<>`. `Key` is trivially hashable, so `reflected_hash<Key>` hashes its
+// object representation in one pass; `Record` has a string and a floating-point member, so member hashes are combined.
+//
+// Usage: bench-reflected_hash [<number of keys>]
+
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <cstddef>     // for size_t
+#include <cstdint>     // for int32_t, uint32_t
+#include <functional>  // for hash<>
+#include <unordered_map>
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, dim, index
+
+#include <makeshift/tuple.hpp>                    // for value_tuple<>
+#include <makeshift/experimental/functional.hpp>  // for reflected_hash<>
+
+#include "bench-common.hpp"  // for measure_seconds(), report_time_per_item(), sink<>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+inline std::size_t
+hash_combine(std::size_t seed, std::size_t hash)
+{
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+
+struct Key
+{
+    std::int32_t x, y, z;
+    std::uint32_t level;
+
+    friend bool operator ==(Key const& lhs, Key const& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.level == rhs.level;
+    }
+};
+constexpr auto
+reflect(gsl::type_identity<Key>)
+{
+    return mk::value_tuple{ &Key::x, &Key::y, &Key::z, &Key::level };
+}
+
+struct KeyHash
+{
+    std::size_t
+    operator ()(Key const& key) const noexcept
+    {
+        std::size_t result = std::hash<std::int32_t>{ }(key.x);
+        result = hash_combine(result, std::hash<std::int32_t>{ }(key.y));
+        result = hash_combine(result, std::hash<std::int32_t>{ }(key.z));
+        return hash_combine(result, std::hash<std::uint32_t>{ }(key.level));
+    }
+};
+
+
+struct Record
+{
+    std::string name;
+    double version;
+    std::int32_t id;
+
+    friend bool operator ==(Record const& lhs, Record const& rhs)
+    {
+        return lhs.name == rhs.name && lhs.version == rhs.version && lhs.id == rhs.id;
+    }
+};
+constexpr auto
+reflect(gsl::type_identity<Record>)
+{
+    return mk::value_tuple{ &Record::name, &Record::version, &Record::id };
+}
+
+struct RecordHash
+{
+    std::size_t
+    operator ()(Record const& record) const noexcept
+    {
+        std::size_t result = std::hash<std::string>{ }(record.name);
+        result = hash_combine(result, std::hash<double>{ }(record.version));
+        return hash_combine(result, std::hash<std::int32_t>{ }(record.id));
+    }
+};
+
+
+template <typename HashT, typename T>
+void
+run_hash(std::vector<T> const& keys)
+{
+    auto hash = HashT{ };
+    std::size_t result = 0;
+    for (auto const& key : keys)
+    {
+        result += hash(key);
+    }
+    bench::sink<std::size_t> = result;
+}
+
+template <typename HashT, typename T>
+void
+run_map(std::vector<T> const& keys)
+{
+    auto map = std::unordered_map<T, int, HashT>(keys.size());
+    for (auto const& key : keys)
+    {
+        ++map[key];
+    }
+    std::size_t result = 0;
+    for (auto const& key : keys)
+    {
+        result += std::size_t(map.find(key)->second);
+    }
+    bench::sink<std::size_t> = result;
+}
+
+
+} // anonymous namespace
+
+
+int
+main(int argc, char* argv[])
+{
+    gsl::dim n = argc > 1 ? gsl::dim(std::stoll(argv[1])) : gsl::dim(1) << 20;
+    int numReps = 10;
+
+    auto keys = std::vector<Key>(n);
+    auto records = std::vector<Record>(n);
+    for (gsl::index i = 0; i != n; ++i)
+    {
+        keys[i] = Key{ std::int32_t(i % 128), std::int32_t(i/128 % 128), std::int32_t(i/16384), std::uint32_t(i % 7) };
+        records[i] = Record{ "record/" + std::to_string(i % 4096), 1. + double(i/4096), std::int32_t(i) };
+    }
+
+    std::printf("n = %lld\n", static_cast<long long>(n));
+
+    bench::report_time_per_item("Key: hash, hand-written", bench::measure_seconds([&] { run_hash<KeyHash>(keys); }, numReps), double(n), "key");
+    bench::report_time_per_item("Key: hash, reflected_hash<>", bench::measure_seconds([&] { run_hash<mk::reflected_hash<Key>>(keys); }, numReps), double(n), "key");
+    bench::report_time_per_item("Key: unordered_map<>, hand-written", bench::measure_seconds([&] { run_map<KeyHash>(keys); }, numReps), double(n), "key");
+    bench::report_time_per_item("Key: unordered_map<>, reflected_hash<>", bench::measure_seconds([&] { run_map<mk::reflected_hash<Key>>(keys); }, numReps), double(n), "key");
+
+    bench::report_time_per_item("Record: hash, hand-written", bench::measure_seconds([&] { run_hash<RecordHash>(records); }, numReps), double(n), "key");
+    bench::report_time_per_item("Record: hash, reflected_hash<>", bench::measure_seconds([&] { run_hash<mk::reflected_hash<Record>>(records); }, numReps), double(n), "key");
+    bench::report_time_per_item("Record: unordered_map<>, hand-written", bench::measure_seconds([&] { run_map<RecordHash>(records); }, numReps), double(n), "key");
+    bench::report_time_per_item("Record: unordered_map<>, reflected_hash<>", bench::measure_seconds([&] { run_map<mk::reflected_hash<Record>>(records); }, numReps), double(n), "key");
+}
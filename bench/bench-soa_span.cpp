@@ -0,0 +1,90 @@
+// Compares loops over the elements of a `soa_span<>` with equivalent loops over parallel raw pointers. Since `soa_span<>`
+// iterators advance a tuple of element pointers, the iterator-based loops should be vectorized like the pointer loops.
+//
+// Usage: bench-soa_span [<number of elements>]
+
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, index, span<>
+
+#include <makeshift/experimental/span.hpp>  // for soa_span<>
+
+#include "bench-common.hpp"  // for measure_seconds(), report_bandwidth(), sink<>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+void
+triad_pointers(double* __restrict zs, double const* __restrict xs, double const* __restrict ys, gsl::dim n)
+{
+    for (gsl::index i = 0; i != n; ++i)
+    {
+        zs[i] = xs[i] + 3.*ys[i];
+    }
+}
+
+void
+triad_soa_span_iterators(mk::soa_span<double, double const, double const> zxy)
+{
+    for (auto&& [z, x, y] : zxy)
+    {
+        z = x + 3.*y;
+    }
+}
+
+double
+dot_pointers(double const* __restrict xs, double const* __restrict ys, gsl::dim n)
+{
+    double result = 0.;
+    for (gsl::index i = 0; i != n; ++i)
+    {
+        result += xs[i]*ys[i];
+    }
+    return result;
+}
+
+double
+dot_soa_span_iterators(mk::soa_span<double const, double const> xy)
+{
+    double result = 0.;
+    for (auto&& [x, y] : xy)
+    {
+        result += x*y;
+    }
+    return result;
+}
+
+
+} // anonymous namespace
+
+
+int
+main(int argc, char* argv[])
+{
+    gsl::dim n = argc > 1 ? gsl::dim(std::stoll(argv[1])) : gsl::dim(1) << 22;
+    int numReps = 20;
+
+    auto xs = std::vector<double>(n, 1.);
+    auto ys = std::vector<double>(n, 2.);
+    auto zs = std::vector<double>(n, 0.);
+
+    std::printf("n = %lld\n", static_cast<long long>(n));
+
+    auto zxy = mk::soa_span<double, double const, double const>(gsl::span<double>(zs), gsl::span<double const>(xs), gsl::span<double const>(ys));
+    auto xy = mk::soa_span<double const, double const>(gsl::span<double const>(xs), gsl::span<double const>(ys));
+
+    double triadBytes = 3.*sizeof(double)*n;
+    bench::report_bandwidth("triad, raw pointers", bench::measure_seconds([&] { triad_pointers(zs.data(), xs.data(), ys.data(), n); }, numReps), triadBytes);
+    bench::report_bandwidth("triad, soa_span<> iterators", bench::measure_seconds([&] { triad_soa_span_iterators(zxy); }, numReps), triadBytes);
+
+    double dotBytes = 2.*sizeof(double)*n;
+    bench::report_bandwidth("dot, raw pointers", bench::measure_seconds([&] { bench::sink<double> = dot_pointers(xs.data(), ys.data(), n); }, numReps), dotBytes);
+    bench::report_bandwidth("dot, soa_span<> iterators", bench::measure_seconds([&] { bench::sink<double> = dot_soa_span_iterators(xy); }, numReps), dotBytes);
+}
@@ -0,0 +1,86 @@
+// Compares `sort_by_members()` and `sort_by_members_parallel()` with `std::sort()` and `std::stable_sort()` using a
+// comparison lambda for sorting COO triplets by row and column index. The sorted arrays are restored from a shuffled copy
+// before every repetition, which is included in the timings.
+//
+// Usage: bench-sort_by_members [<number of entries>]
+
+
+#include <tuple>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int32_t
+#include <algorithm>  // for sort(), stable_sort()
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, dim
+
+#include <makeshift/tuple.hpp>                   // for value_tuple<>
+#include <makeshift/constval.hpp>                // for MAKESHIFT_CONSTVAL()
+#include <makeshift/experimental/algorithm.hpp>  // for sort_by_members()
+#include <makeshift/experimental/parallel.hpp>   // for sort_by_members_parallel()
+
+#include "bench-common.hpp"  // for measure_seconds(), report_time_per_item(), sink<>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+struct COO
+{
+    std::int32_t i;
+    std::int32_t j;
+    double v;
+};
+constexpr auto
+reflect(gsl::type_identity<COO>)
+{
+    return mk::value_tuple{ &COO::i, &COO::j, &COO::v };
+}
+
+
+template <typename SortF>
+void
+run_sort(std::vector<COO> const& input, std::vector<COO>& entries, SortF&& sort)
+{
+    entries = input;
+    sort(entries);
+    bench::sink<std::size_t> = std::size_t(entries.front().i + entries.back().j);
+}
+
+
+} // anonymous namespace
+
+
+int
+main(int argc, char* argv[])
+{
+    gsl::dim n = argc > 1 ? gsl::dim(std::stoll(argv[1])) : gsl::dim(1) << 22;
+    int numReps = 5;
+
+    auto rng = std::mt19937{ 42 };
+    auto indexDist = std::uniform_int_distribution<std::int32_t>(0, 1 << 16);
+    auto input = std::vector<COO>(std::size_t(n));
+    for (auto& entry : input)
+    {
+        entry = COO{ indexDist(rng), indexDist(rng), 1. };
+    }
+    auto entries = std::vector<COO>{ };
+
+    auto lessIJ = [](COO const& lhs, COO const& rhs)
+    {
+        return std::tie(lhs.i, lhs.j) < std::tie(rhs.i, rhs.j);
+    };
+    auto ijC = MAKESHIFT_CONSTVAL(std::tuple{ &COO::i, &COO::j });
+
+    std::printf("n = %lld\n", static_cast<long long>(n));
+
+    bench::report_time_per_item("std::sort()", bench::measure_seconds([&] { run_sort(input, entries, [&](auto& e) { std::sort(e.begin(), e.end(), lessIJ); }); }, numReps), double(n), "entry");
+    bench::report_time_per_item("std::stable_sort()", bench::measure_seconds([&] { run_sort(input, entries, [&](auto& e) { std::stable_sort(e.begin(), e.end(), lessIJ); }); }, numReps), double(n), "entry");
+    bench::report_time_per_item("sort_by_members()", bench::measure_seconds([&] { run_sort(input, entries, [&](auto& e) { mk::sort_by_members(e.begin(), e.end(), ijC); }); }, numReps), double(n), "entry");
+    bench::report_time_per_item("sort_by_members_parallel()", bench::measure_seconds([&] { run_sort(input, entries, [&](auto& e) { mk::sort_by_members_parallel(e.begin(), e.end(), ijC); }); }, numReps), double(n), "entry");
+}
@@ -3,9 +3,10 @@
 #define INCLUDED_MAKESHIFT_ALGORITHM_HPP_
 
 
-#include <cstddef>      // for ptrdiff_t
-#include <utility>      // for forward<>(), swap()
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <utility>      // for forward<>(), swap(), make_index_sequence<>
 #include <iterator>     // for iterator_traits<>
+#include <tuple>        // for forward_as_tuple()
 #include <type_traits>  // for integral_constant<>, decay<>, conjunction<>
 
 #include <gsl-lite/gsl-lite.hpp>  // for index, gsl_Expects(), gsl_CPP17_OR_GREATER
@@ -75,7 +76,7 @@ range_zip(Rs&&... ranges)
 }
 
 
-// TODO: define iota_view(), sub_view()
+// Lazy views such as `iota_view()`, `sub_view()`, or `transform_view()` are defined in <makeshift/experimental/views.hpp>.
 
 
     //
@@ -103,6 +104,118 @@ range_for(F&& func, Rs&&... ranges)
 }
 
 
+    //
+    // Takes a scalar procedure and calls the procedure for every set of elements in the given ranges, like `range_for()`. The
+    // loop body is unrolled `Unroll` times; the remaining elements are processed by a non-unrolled loop.
+    //ᅟ
+    //ᅟ    range_for<4>(
+    //ᅟ        [](double& y, double x) { y += 2*x; },
+    //ᅟ        ys, xs);
+    //
+    // The unroll factor can be chosen at runtime with `expand()`:
+    //ᅟ
+    //ᅟ    auto unrollV = expand_failfast(unroll, MAKESHIFT_CONSTVAL(std::array{ 1, 2, 4, 8 }));
+    //ᅟ    visit(
+    //ᅟ        [&](auto unrollC) {
+    //ᅟ            range_for<unrollC()>(kernel, ys, xs);
+    //ᅟ        },
+    //ᅟ        unrollV);
+    //
+    // At least one range must have a known size.
+    //
+template <std::size_t Unroll, typename F, typename... Rs>
+constexpr void
+range_for(F&& func, Rs&&... ranges)
+{
+    static_assert(Unroll > 0, "unroll factor must be positive");
+    static_assert(!std::conjunction_v<std::is_same<std::decay_t<Rs>, detail::range_index_t>...>, "no range argument given");
+
+    auto mergedSize = detail::merge_sizes(detail::range_size(ranges)...);
+    static_assert(!std::is_same<decltype(mergedSize), detail::dim_constant<detail::unknown_size>>::value, "unrolled range_for() requires at least one range of known size");
+
+    gsl::dim n = mergedSize;
+    gsl::dim numBlocks = n / gsl::dim(Unroll);
+    auto it = detail::make_zip_begin_iterator(mergedSize, ranges...);
+    for (gsl::index b = 0; b != numBlocks; ++b)
+    {
+        detail::range_for_unrolled<Unroll>(it, func);
+    }
+    for (gsl::index i = numBlocks*gsl::dim(Unroll); i != n; ++i, ++it)
+    {
+        it.apply(func);
+    }
+}
+
+
+    //
+    // Like `range_for()`, but issues software prefetches for the elements `distanceC()` positions ahead of the current position.
+    // Prefetches are issued for all contiguous ranges (i.e. ranges which have `data()` and `size()` members). This can improve
+    // throughput for memory-bound passes over ranges much larger than the last-level cache.
+    //ᅟ
+    //ᅟ    range_for_prefetch(
+    //ᅟ        MAKESHIFT_CONSTVAL(gsl::dim(64)),
+    //ᅟ        [](double& y, double x) { y += 2*x; },
+    //ᅟ        ys, xs);
+    //
+    // At least one range must have a known size. Only the elements of the ranges passed are prefetched: in a gather such as
+    // `y += x[idx]` over a range of indices `idx`, the index range is prefetched, but the elements of `x` it refers to are not.
+    //
+template <typename DistanceC, typename F, typename... Rs>
+void
+range_for_prefetch(DistanceC distanceC, F&& func, Rs&&... ranges)
+{
+    constexpr gsl::dim distance = distanceC();
+    static_assert(distance > 0, "prefetch distance must be positive");
+    static_assert(!std::conjunction_v<std::is_same<std::decay_t<Rs>, detail::range_index_t>...>, "no range argument given");
+
+    auto mergedSize = detail::merge_sizes(detail::range_size(ranges)...);
+    static_assert(!std::is_same<decltype(mergedSize), detail::dim_constant<detail::unknown_size>>::value, "range_for_prefetch() requires at least one range of known size");
+
+    gsl::dim n = mergedSize;
+    gsl::dim numPrefetched = n > distance ? n - distance : 0;
+    auto it = detail::make_zip_begin_iterator(mergedSize, ranges...);
+    for (gsl::index i = 0; i != numPrefetched; ++i, ++it)
+    {
+        it._prefetch(distance);
+        it.apply(func);
+    }
+    for (gsl::index i = numPrefetched; i != n; ++i, ++it)
+    {
+        it.apply(func);
+    }
+}
+
+
+    //
+    // Takes a tile size constval, a list of scalar procedures, and a list of ranges, and calls every procedure for every set of
+    // elements in the given ranges. The ranges are traversed in tiles of `tileSizeC()` elements; all procedures are called for
+    // the elements of a tile, in the order given, before advancing to the next tile, such that data loaded by one procedure is
+    // likely still in cache when the next procedure accesses it.
+    //ᅟ
+    //ᅟ    range_for_tiled(
+    //ᅟ        MAKESHIFT_CONSTVAL(gsl::dim(256)),
+    //ᅟ        [](double& y, double x) { y = 2*x; },
+    //ᅟ        [](double& y, double x) { y += x*x; },
+    //ᅟ        ys, xs);
+    //
+    // The ranges must be multi-pass, and at least one range must have a known size.
+    //
+template <typename TileSizeC, typename... ArgsT>
+constexpr void
+range_for_tiled(TileSizeC tileSizeC, ArgsT&&... args)
+{
+    constexpr gsl::dim tileSize = tileSizeC();
+    static_assert(tileSize > 0, "tile size must be positive");
+    constexpr std::size_t numFuncs = detail::num_leading_non_range_arguments<ArgsT...>();
+    static_assert(numFuncs != 0, "no procedure given");
+    static_assert(numFuncs != sizeof...(ArgsT), "no range argument given");
+
+    detail::range_for_tiled_impl<tileSize>(
+        std::make_index_sequence<numFuncs>{ }, std::make_index_sequence<sizeof...(ArgsT) - numFuncs>{ },
+        std::forward_as_tuple(args...));
+}
+
+
     //
     // Fills the range with sequentially increasing values, starting with `value` and repetitively evaluating `++value`.
     //
@@ -179,6 +292,90 @@ range_transform_reduce(T&& initialValue, ReduceFuncT&& reduce, TransformFuncT&&
 }
 
 
+    //
+    // Takes an initial value, a reducer, a transformer, and a list of ranges and reduces them to a scalar value, like
+    // `range_transform_reduce()`. The loop body is unrolled `Unroll` times; the remaining elements are processed by a
+    // non-unrolled loop. Elements are reduced in order, so the result is identical to that of `range_transform_reduce()` even
+    // for non-associative reducers.
+    //ᅟ
+    //ᅟ    range_transform_reduce<4>(
+    //ᅟ        0.,
+    //ᅟ        std::plus<>{ },
+    //ᅟ        [](double x, double y) { return x*y; },
+    //ᅟ        xs, ys);
+    //ᅟ    // returns the dot product of `xs` and `ys`
+    //
+    // At least one range must have a known size.
+    //
+template <std::size_t Unroll, typename T, typename ReduceFuncT, typename TransformFuncT, typename... Rs>
+[[nodiscard]] constexpr std::decay_t<T>
+range_transform_reduce(T&& initialValue, ReduceFuncT&& reduce, TransformFuncT&& transform, Rs&&... ranges)
+{
+    static_assert(Unroll > 0, "unroll factor must be positive");
+    static_assert(!std::conjunction_v<std::is_same<std::decay_t<Rs>, detail::range_index_t>...>, "no range argument given");
+
+    auto mergedSize = detail::merge_sizes(detail::range_size(ranges)...);
+    static_assert(!std::is_same<decltype(mergedSize), detail::dim_constant<detail::unknown_size>>::value, "unrolled range_transform_reduce() requires at least one range of known size");
+
+    gsl::dim n = mergedSize;
+    gsl::dim numBlocks = n / gsl::dim(Unroll);
+    std::decay_t<T> result = std::forward<T>(initialValue);
+    auto it = detail::make_zip_begin_iterator(mergedSize, ranges...);
+    for (gsl::index b = 0; b != numBlocks; ++b)
+    {
+        detail::range_transform_reduce_unrolled<Unroll>(it, result, reduce, transform);
+    }
+    for (gsl::index i = numBlocks*gsl::dim(Unroll); i != n; ++i, ++it)
+    {
+        result = reduce(std::move(result), it.apply(transform));
+    }
+    return result;
+}
+
+
+    //
+    // Like `range_transform_reduce()`, but issues software prefetches for the elements `distanceC()` positions ahead of the
+    // current position. Prefetches are issued for all contiguous ranges (i.e. ranges which have `data()` and `size()` members).
+    // As with `range_for_prefetch()`, elements accessed indirectly through the elements of the ranges are not prefetched.
+    //ᅟ
+    //ᅟ    range_transform_reduce_prefetch(
+    //ᅟ        MAKESHIFT_CONSTVAL(gsl::dim(64)),
+    //ᅟ        0.,
+    //ᅟ        std::plus<>{ },
+    //ᅟ        [](double x, double y) { return x*y; },
+    //ᅟ        xs, ys);
+    //ᅟ    // returns the dot product of `xs` and `ys`
+    //
+    // At least one range must have a known size.
+    //
+template <typename DistanceC, typename T, typename ReduceFuncT, typename TransformFuncT, typename... Rs>
+[[nodiscard]] std::decay_t<T>
+range_transform_reduce_prefetch(DistanceC distanceC, T&& initialValue, ReduceFuncT&& reduce, TransformFuncT&& transform, Rs&&... ranges)
+{
+    constexpr gsl::dim distance = distanceC();
+    static_assert(distance > 0, "prefetch distance must be positive");
+    static_assert(!std::conjunction_v<std::is_same<std::decay_t<Rs>, detail::range_index_t>...>, "no range argument given");
+
+    auto mergedSize = detail::merge_sizes(detail::range_size(ranges)...);
+    static_assert(!std::is_same<decltype(mergedSize), detail::dim_constant<detail::unknown_size>>::value, "range_transform_reduce_prefetch() requires at least one range of known size");
+
+    gsl::dim n = mergedSize;
+    gsl::dim numPrefetched = n > distance ? n - distance : 0;
+    auto result = std::forward<T>(initialValue);
+    auto it = detail::make_zip_begin_iterator(mergedSize, ranges...);
+    for (gsl::index i = 0; i != numPrefetched; ++i, ++it)
+    {
+        it._prefetch(distance);
+        result = reduce(std::move(result), it.apply(transform));
+    }
+    for (gsl::index i = numPrefetched; i != n; ++i, ++it)
+    {
+        result = reduce(std::move(result), it.apply(transform));
+    }
+    return result;
+}
+
+
     //
     // Takes an initial value, a reducer, and a range and reduces it to a scalar value.
     //ᅟ
@@ -5,11 +5,14 @@
 
 #include <cstddef>      // for size_t, ptrdiff_t
 #include <tuple>
-#include <utility>      // for forward<>(), integer_sequence<>
-#include <type_traits>  // for integral_constant<>, declval<>(), decay<>
+#include <utility>      // for forward<>(), move(), integer_sequence<>
+#include <iterator>     // for begin(), random_access_iterator_tag
+#include <type_traits>  // for integral_constant<>, declval<>(), decay<>, remove_cv<>, remove_reference<>, is_base_of<>
 
 #include <gsl-lite/gsl-lite.hpp>  // for dim, index
 
+#include <makeshift/tuple.hpp>  // for template_for()
+
 #include <makeshift/detail/macros.hpp>  // for MAKESHIFT_DETAIL_EMPTY_BASES, MAKESHIFT_DETAIL_FORCEINLINE
 #include <makeshift/detail/ranges.hpp>  // for range_index_t
 #include <makeshift/detail/zip.hpp>
@@ -134,7 +137,7 @@ public:
     }
 
         // LegacyIterator: dereference, increment
-    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator *(void)
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator *(void) const
     {
         return reference{ detail::get_leaf<Is>(*this)._deref(i_)... };
     }
@@ -194,7 +197,7 @@ public:
     }
 
         // RandomAccessIterator: subscript, arithmetic, ordering compare
-    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator [](std::ptrdiff_t d)
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator [](std::ptrdiff_t d) const
     {
         return reference{ detail::get_leaf<Is>(*this)._deref(i_, d)... };
     }
@@ -250,6 +253,18 @@ public:
     {
         return func(detail::get_leaf<Is>(*this)._deref(i_)...);
     }
+    template <typename F>
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr decltype(auto) apply(F&& func, std::ptrdiff_t d)
+    {
+        return func(detail::get_leaf<Is>(*this)._deref(i_, d)...);
+    }
+
+        // prefetches the elements `d` positions ahead for all leaves which support random access by index
+    MAKESHIFT_DETAIL_FORCEINLINE void _prefetch(std::ptrdiff_t d) const noexcept
+    {
+        using Swallow = int[];
+        (void) Swallow{ 1, (detail::get_leaf<Is>(*this)._prefetch(i_, d), 0)... };
+    }
 };
 template <typename N, typename... Rs>
 struct zip_iterator
@@ -367,7 +382,7 @@ class zip_range_base<N, std::index_sequence<Is...>, Rs...>
     : public zip_range_size_base<N>
 {
 private:
-    using iterator = zip_iterator<N, Rs&...>;
+    using iterator = zip_iterator<N, Rs const&...>;  // `Rs const&` collapses to `Rs` for lvalue references
 
     std::tuple<Rs...> ranges_;
 
@@ -406,7 +421,7 @@ class zip_range_subscript_base<true, N, Rs...>
     using base::base;
 
 private:
-    using iterator = zip_iterator<N, Rs&...>;
+    using iterator = zip_iterator<N, Rs const&...>;
 
 public:
     [[nodiscard]] constexpr MAKESHIFT_DETAIL_FORCEINLINE typename iterator::reference
@@ -434,7 +449,7 @@ class zip_common_range
     : public zip_range_subscript_base<ranges_are_random_access_<Rs...>::value, N, Rs...>
 {
 private:
-    using iterator = zip_iterator<N, Rs&...>;
+    using iterator = zip_iterator<N, Rs const&...>;
 
     using base = zip_range_subscript_base<ranges_are_random_access_<Rs...>::value, N, Rs...>;
     using base::base;
@@ -453,6 +468,100 @@ constexpr zip_common_range<N, Rs...> make_zip_common_range(N n, Rs&&... ranges)
 }
 
 
+template <std::size_t Unroll, typename It, typename F>
+MAKESHIFT_DETAIL_FORCEINLINE constexpr void
+range_for_unrolled(It& it, F& func)
+{
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, typename It::iterator_category>::value)
+    {
+        makeshift::template_for<Unroll>(
+            [&](auto dC) { it.apply(func, dC()); },
+            tuple_index);
+        it += Unroll;
+    }
+    else
+    {
+        makeshift::template_for<Unroll>(
+            [&] { it.apply(func); ++it; });
+    }
+}
+
+template <std::size_t Unroll, typename It, typename T, typename ReduceFuncT, typename TransformFuncT>
+MAKESHIFT_DETAIL_FORCEINLINE constexpr void
+range_transform_reduce_unrolled(It& it, T& result, ReduceFuncT& reduce, TransformFuncT& transform)
+{
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, typename It::iterator_category>::value)
+    {
+        makeshift::template_for<Unroll>(
+            [&](auto dC) { result = reduce(std::move(result), it.apply(transform, dC())); },
+            tuple_index);
+        it += Unroll;
+    }
+    else
+    {
+        makeshift::template_for<Unroll>(
+            [&] { result = reduce(std::move(result), it.apply(transform)); ++it; });
+    }
+}
+
+
+template <typename T, typename = void> struct is_range_argument_ : std::false_type { };
+template <typename T> struct is_range_argument_<T, std::void_t<decltype(std::begin(std::declval<T&>()))>> : std::true_type { };
+template <> struct is_range_argument_<range_index_t> : std::true_type { };
+
+template <typename... Ts>
+constexpr std::size_t
+num_leading_non_range_arguments(void) noexcept
+{
+    constexpr bool isRange[] = { is_range_argument_<std::remove_cv_t<std::remove_reference_t<Ts>>>::value..., true };
+    std::size_t n = 0;
+    while (!isRange[n]) ++n;
+    return n;
+}
+
+template <typename It, typename N, typename F>
+MAKESHIFT_DETAIL_FORCEINLINE constexpr void
+range_for_n(It& it, N n, F& func)
+{
+    for (gsl::dim i = 0; i != gsl::dim(n); ++i, ++it)
+    {
+        it.apply(func);
+    }
+}
+
+template <typename It, typename N, typename... Fs>
+MAKESHIFT_DETAIL_FORCEINLINE constexpr void
+range_for_tile(It& tileIt, N tileSize, Fs&... funcs)
+{
+    It it = tileIt;
+    using Swallow = int[];
+    (void) Swallow{ 1, (it = tileIt, detail::range_for_n(it, tileSize, funcs), int{ })... };
+    tileIt = it;
+}
+
+template <gsl::dim TileSize, std::size_t... FIs, std::size_t... RIs, typename ArgsT>
+constexpr void
+range_for_tiled_impl(std::index_sequence<FIs...>, std::index_sequence<RIs...>, ArgsT args)
+{
+    constexpr std::size_t numFuncs = sizeof...(FIs);
+
+    auto mergedSize = detail::merge_sizes(detail::range_size(std::get<numFuncs + RIs>(args))...);
+    static_assert(!std::is_same<decltype(mergedSize), dim_constant<unknown_size>>::value, "range_for_tiled() requires at least one range of known size");
+
+    auto tileIt = detail::make_zip_begin_iterator(mergedSize, std::get<numFuncs + RIs>(args)...);
+    gsl::dim numTiles = gsl::dim(mergedSize) / TileSize;
+    for (gsl::dim t = 0; t != numTiles; ++t)
+    {
+        detail::range_for_tile(tileIt, dim_constant<TileSize>{ }, std::get<FIs>(args)...);
+    }
+    gsl::dim remainder = gsl::dim(mergedSize) - numTiles*TileSize;
+    if (remainder != 0)
+    {
+        detail::range_for_tile(tileIt, remainder, std::get<FIs>(args)...);
+    }
+}
+
+
 } // namespace detail
 
 } // namespace makeshift
@@ -29,4 +29,18 @@
 #endif
 
 
+    //
+    // `MAKESHIFT_DETAIL_PREFETCH(addr)` hints the processor to load the cache line containing the given address for reading.
+    // The address need not be dereferenceable.
+    //
+#if defined(__GNUC__)
+# define MAKESHIFT_DETAIL_PREFETCH(addr)  __builtin_prefetch(addr)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+# include <xmmintrin.h>  // for _mm_prefetch()
+# define MAKESHIFT_DETAIL_PREFETCH(addr)  _mm_prefetch(reinterpret_cast<char const*>(addr), _MM_HINT_T0)
+#else
+# define MAKESHIFT_DETAIL_PREFETCH(addr)  ((void) (addr))
+#endif
+
+
 #endif // INCLUDED_MAKESHIFT_DETAIL_MACROS_HPP_
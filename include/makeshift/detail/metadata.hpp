@@ -6,6 +6,7 @@
 #include <array>
 #include <tuple>
 #include <cstddef>      // for size_t
+#include <cstdint>      // for uint16_t, uint32_t
 #include <utility>      // for index_sequence<>, tuple_size<>, forward<>()
 #include <optional>
 #include <functional>   // for invoke()
@@ -73,6 +74,8 @@ is_available(T const&)
 {
     return { };
 }
+template <typename T>
+constexpr bool is_available_v = !std::is_same_v<T, std::nullopt_t>;
 
 
 template <typename, typename M> struct is_string_like : std::is_convertible<M, std::string_view> { };
@@ -137,6 +140,94 @@ template <typename T, typename M, std::size_t... Is> struct is_member_tuple_0_<T
 template <typename T, typename M, typename = void> struct is_member_tuple : std::false_type { };
 template <typename T, typename M> struct is_member_tuple<T, M, std::void_t<typename std::tuple_size<M>::type>> : is_member_tuple_0_<T, M, std::make_index_sequence<std::tuple_size_v<M>>> { };
 
+    // Kinds of metadata entries, used to classify the metadata of a type and its elements once rather than searching the
+    // metadata with a separate predicate for every accessor.
+enum metadata_entry_kind : unsigned
+{
+    value_entry               = 1u << 0,
+    value_record_entry        = 1u << 1,
+    value_array_entry         = 1u << 2,
+    value_record_tuple_entry  = 1u << 3,
+    member_entry              = 1u << 4,
+    member_record_entry       = 1u << 5,
+    member_tuple_entry        = 1u << 6,
+    member_record_tuple_entry = 1u << 7,
+    base_entry                = 1u << 8,
+    base_record_entry         = 1u << 9,
+    base_tuple_entry          = 1u << 10,
+    base_record_tuple_entry   = 1u << 11
+};
+
+template <typename T, typename M>
+constexpr unsigned
+metadata_entry_kinds(void) noexcept
+{
+    return (is_value<T, M>::value ? value_entry : 0u)
+        | (is_value_record<T, M>::value ? value_record_entry : 0u)
+        | (is_value_array<T, M>::value ? value_array_entry : 0u)
+        | (is_value_record_tuple<T, M>::value ? value_record_tuple_entry : 0u)
+        | (is_member<T, M>::value ? member_entry : 0u)
+        | (is_member_record<T, M>::value ? member_record_entry : 0u)
+        | (is_member_tuple<T, M>::value ? member_tuple_entry : 0u)
+        | (is_member_record_tuple<T, M>::value ? member_record_tuple_entry : 0u)
+        | (is_base<T, M>::value ? base_entry : 0u)
+        | (is_base_record<T, M>::value ? base_record_entry : 0u)
+        | (is_base_tuple<T, M>::value ? base_tuple_entry : 0u)
+        | (is_base_record_tuple<T, M>::value ? base_record_tuple_entry : 0u);
+}
+
+template <typename T, typename M, std::size_t... Is>
+constexpr std::array<unsigned, sizeof...(Is)>
+metadata_element_kinds(std::index_sequence<Is...>) noexcept
+{
+    return { detail::metadata_entry_kinds<T, std::tuple_element_t<Is, M>>()... };
+}
+
+template <typename M, typename = void> struct is_tuple_like_metadata : std::false_type { };
+template <typename M> struct is_tuple_like_metadata<M, std::void_t<typename std::tuple_size<M>::type>> : std::true_type { };
+
+constexpr std::size_t metadata_entry_self = std::size_t(-2);
+constexpr std::size_t metadata_entry_none = std::size_t(-1);
+
+    // Returns `metadata_entry_self` if the metadata `M` itself is an entry of the given kind, or the index of the first element
+    // of `M` which is an entry of the given kind, or `metadata_entry_none`. This mirrors `extract_metadata<>()` with occurrence 0.
+template <typename T, typename M>
+constexpr std::size_t
+find_metadata_entry(unsigned kind) noexcept
+{
+    if ((detail::metadata_entry_kinds<T, M>() & kind) != 0) return metadata_entry_self;
+    if constexpr (is_tuple_like_metadata<M>::value)
+    {
+        constexpr auto kinds = detail::metadata_element_kinds<T, M>(std::make_index_sequence<std::tuple_size_v<M>>{ });
+        for (std::size_t i = 0; i != kinds.size(); ++i)
+        {
+            if ((kinds[i] & kind) != 0) return i;
+        }
+    }
+    return metadata_entry_none;
+}
+
+template <typename T, typename M>
+constexpr bool
+has_metadata_entry(unsigned kind) noexcept
+{
+    return detail::find_metadata_entry<T, M>(kind) != metadata_entry_none;
+}
+
+template <typename T, unsigned Kind, typename M>
+constexpr auto const&
+get_metadata_entry(M const& md) noexcept
+{
+    constexpr std::size_t i = detail::find_metadata_entry<T, M>(Kind);
+    static_assert(i != metadata_entry_none);
+    if constexpr (i == metadata_entry_self) return md;
+    else
+    {
+        using std::get;
+        return get<i>(md);
+    }
+}
+
 template <typename T, typename M, template <typename...> class PredT, std::size_t N, std::size_t I, int Occurrence, typename ArgsT>
 struct record_index_0_;
 template <typename T, typename M, template <typename...> class PredT, std::size_t N, std::size_t I, int Occurrence, bool Match, typename ArgsT>
@@ -279,22 +370,22 @@ template <typename T, typename M>
 constexpr decltype(auto)
 extract_bases([[maybe_unused]] M const& md)
 {
-    if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_base_record_tuple, 0>(md))>, std::nullopt_t>)
+    if constexpr (detail::has_metadata_entry<T, M>(base_record_tuple_entry))
     {
-        return detail::extract_heterogeneous_column<0>(detail::extract_metadata<T, is_base_record_tuple, 0>(md));
+        return detail::extract_heterogeneous_column<0>(detail::get_metadata_entry<T, base_record_tuple_entry>(md));
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_base_tuple, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(base_tuple_entry))
     {
-        return detail::extract_metadata<T, is_base_tuple, 0>(md);
+        return detail::get_metadata_entry<T, base_tuple_entry>(md);
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_base_record, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(base_record_entry))
     {
         using std::get;
-        return std::tuple{ get<0>(detail::extract_metadata<T, is_base_record, 0>(md)) };
+        return std::tuple{ get<0>(detail::get_metadata_entry<T, base_record_entry>(md)) };
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_base, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(base_entry))
     {
-        return std::tuple{ detail::extract_metadata<T, is_base, 0>(md) };
+        return std::tuple{ detail::get_metadata_entry<T, base_entry>(md) };
     }
     else if constexpr (is_base<T, M>::value)
     {
@@ -313,22 +404,22 @@ template <typename T, typename M>
 constexpr decltype(auto)
 extract_values([[maybe_unused]] M const& md)
 {
-    if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_value_record_tuple, 0>(md))>, std::nullopt_t>)
+    if constexpr (detail::has_metadata_entry<T, M>(value_record_tuple_entry))
     {
-        return detail::extract_column<T, 0>(detail::extract_metadata<T, is_value_record_tuple, 0>(md));
+        return detail::extract_column<T, 0>(detail::get_metadata_entry<T, value_record_tuple_entry>(md));
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_value_array, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(value_array_entry))
     {
-        return detail::extract_metadata<T, is_value_array, 0>(md);
+        return detail::get_metadata_entry<T, value_array_entry>(md);
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_value_record, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(value_record_entry))
     {
         using std::get;
-        return std::array<T, 1>{ get<0>(detail::extract_metadata<T, is_value_record, 0>(md)) };
+        return std::array<T, 1>{ get<0>(detail::get_metadata_entry<T, value_record_entry>(md)) };
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_value, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(value_entry))
     {
-        return std::array<T, 1>{ detail::extract_metadata<T, is_value, 0>(md) };
+        return std::array<T, 1>{ detail::get_metadata_entry<T, value_entry>(md) };
     }
     else if constexpr (is_value<T, M>::value)
     {
@@ -346,22 +437,22 @@ template <typename T, typename M>
 constexpr decltype(auto)
 extract_members([[maybe_unused]] M const& md)
 {
-    if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_member_record_tuple, 0>(md))>, std::nullopt_t>)
+    if constexpr (detail::has_metadata_entry<T, M>(member_record_tuple_entry))
     {
-        return detail::extract_heterogeneous_column<0>(detail::extract_metadata<T, is_member_record_tuple, 0>(md));
+        return detail::extract_heterogeneous_column<0>(detail::get_metadata_entry<T, member_record_tuple_entry>(md));
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_member_tuple, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(member_tuple_entry))
     {
-        return detail::extract_metadata<T, is_member_tuple, 0>(md);
+        return detail::get_metadata_entry<T, member_tuple_entry>(md);
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_member_record, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(member_record_entry))
     {
         using std::get;
-        return std::tuple{ get<0>(detail::extract_metadata<T, is_member_record, 0>(md)) };
+        return std::tuple{ get<0>(detail::get_metadata_entry<T, member_record_entry>(md)) };
     }
-    else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_member, 0>(md))>, std::nullopt_t>)
+    else if constexpr (detail::has_metadata_entry<T, M>(member_entry))
     {
-        return std::tuple{ detail::extract_metadata<T, is_member, 0>(md) };
+        return std::tuple{ detail::get_metadata_entry<T, member_entry>(md) };
     }
     else if constexpr (is_member<T, M>::value)
     {
@@ -423,9 +514,9 @@ template <typename T, typename V, template <typename...> class PredT, int Occurr
 constexpr decltype(auto)
 extract_value_metadata([[maybe_unused]] M const& md)
 {
-    if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_value_record_tuple, 0>(md))>, std::nullopt_t>)
+    if constexpr (detail::has_metadata_entry<T, M>(value_record_tuple_entry))
     {
-        return detail::try_extract_column<T, V, PredT, Occurrence, ArgsT>(detail::extract_metadata<T, is_value_record_tuple, 0>(md));
+        return detail::try_extract_column<T, V, PredT, Occurrence, ArgsT>(detail::get_metadata_entry<T, value_record_tuple_entry>(md));
     }
     //else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_value_record, 0>(md))>, std::nullopt_t>)
     //{
@@ -452,9 +543,9 @@ template <typename T, typename V, template <typename...> class PredT, int Occurr
 constexpr decltype(auto)
 extract_member_metadata([[maybe_unused]] M const& md)
 {
-    if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_member_record_tuple, 0>(md))>, std::nullopt_t>)
+    if constexpr (detail::has_metadata_entry<T, M>(member_record_tuple_entry))
     {
-        return detail::try_extract_column<T, V, PredT, Occurrence, ArgsT>(detail::extract_metadata<T, is_member_record_tuple, 0>(md));
+        return detail::try_extract_column<T, V, PredT, Occurrence, ArgsT>(detail::get_metadata_entry<T, member_record_tuple_entry>(md));
     }
     //else if constexpr (!std::is_same_v<std::decay_t<decltype(detail::extract_metadata<T, is_member_record, 0>(md))>, std::nullopt_t>)
     //{
@@ -491,48 +582,310 @@ search_index(T value, std::array<T, N> values)
 }
 
 
-template <typename T, template <typename...> class TupleT, typename ReflectorT>
-constexpr auto
-all_members()
+    // Seeded FNV-1a hash, used for perfect hashing of names at compile time.
+constexpr std::uint32_t
+hash_name(std::string_view name, std::uint32_t seed) noexcept
 {
-    auto directMembers = detail::extract_members<T>(detail::get_metadata<T, ReflectorT>());
-    if constexpr (detail::is_available(directMembers))
+    std::uint32_t h = 2166136261u ^ (seed*0x9E3779B9u);
+    for (char c : name)
     {
-        auto baseMemberTupleTuple = detail::apply_impl(
-            [](auto&&... bases)
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+constexpr std::size_t
+name_hash_ceil_pow2(std::size_t n) noexcept
+{
+    std::size_t result = 1;
+    while (result < n) result *= 2;
+    return result;
+}
+
+constexpr std::uint32_t name_hash_max_seed = 4096;
+
+    // Hash index of a set of names which maps a name to its index with two hash computations and a single string comparison.
+    // Names are distributed to buckets by a first hash function. For every bucket, a seed is chosen at compile time such that
+    // a second hash function with this seed maps the names in the bucket to table slots not occupied by other names
+    // ("hash and displace"). If no such seeds are found, e.g. because names are not unique, the index falls back to linear
+    // search.
+template <std::size_t N>
+struct name_hash_index
+{
+    static constexpr std::size_t num_buckets = detail::name_hash_ceil_pow2(N/2);
+    static constexpr std::size_t table_size = detail::name_hash_ceil_pow2(2*N);
+
+    std::array<std::string_view, N> names;
+    std::array<std::uint32_t, num_buckets> seeds;
+    std::array<gsl::index, table_size> slots;
+    bool is_perfect;
+
+    constexpr gsl::index
+    search(std::string_view name) const noexcept
+    {
+        if (!is_perfect) return detail::search_index(name, names);
+
+        std::uint32_t seed = seeds[detail::hash_name(name, 0) & (num_buckets - 1)];
+        gsl::index i = slots[detail::hash_name(name, seed) & (table_size - 1)];
+        return i >= 0 && names[i] == name ? i : -1;
+    }
+};
+
+template <std::size_t N>
+constexpr name_hash_index<N>
+make_name_hash_index(std::array<std::string_view, N> const& names) noexcept
+{
+    using Index = name_hash_index<N>;
+    constexpr std::size_t numBuckets = Index::num_buckets;
+    constexpr std::size_t tableSize = Index::table_size;
+
+    auto result = Index{ names, { }, { }, true };
+    for (std::size_t slot = 0; slot != tableSize; ++slot)
+    {
+        result.slots[slot] = -1;
+    }
+
+        // Sort names by bucket.
+    auto bucketStarts = std::array<std::size_t, numBuckets + 1>{ };
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        ++bucketStarts[(detail::hash_name(names[i], 0) & (numBuckets - 1)) + 1];
+    }
+    std::size_t maxBucketSize = 0;
+    for (std::size_t b = 0; b != numBuckets; ++b)
+    {
+        if (bucketStarts[b + 1] > maxBucketSize) maxBucketSize = bucketStarts[b + 1];
+        bucketStarts[b + 1] += bucketStarts[b];
+    }
+    auto bucketEnds = bucketStarts;
+    auto sortedIndices = std::array<std::size_t, N>{ };
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        sortedIndices[bucketEnds[detail::hash_name(names[i], 0) & (numBuckets - 1)]++] = i;
+    }
+
+        // Place larger buckets first because they are harder to place. Rather than clearing the marks for every attempt,
+        // slots are marked with the attempt number.
+    auto marks = std::array<std::uint32_t, tableSize>{ };
+    std::uint32_t attempt = 0;
+    for (std::size_t bucketSize = maxBucketSize; bucketSize != 0; --bucketSize)
+    {
+        for (std::size_t b = 0; b != numBuckets; ++b)
+        {
+            if (bucketStarts[b + 1] - bucketStarts[b] != bucketSize) continue;
+
+            bool placed = false;
+            for (std::uint32_t seed = 1; seed != name_hash_max_seed && !placed; ++seed)
             {
-                return TupleT<decltype(detail::all_members<typename std::remove_cv_t<std::remove_reference_t<decltype(bases)>>::type, TupleT, ReflectorT>())...>{
-                    detail::all_members<typename std::remove_cv_t<std::remove_reference_t<decltype(bases)>>::type, TupleT, ReflectorT>()...
-                };
-            },
-            detail::extract_bases<T>(detail::get_metadata<T, ReflectorT>()));
-        return detail::apply_impl(
-            [&directMembers](auto&&... baseMemberTuples)
+                ++attempt;
+                placed = true;
+                for (std::size_t k = bucketStarts[b]; k != bucketStarts[b + 1] && placed; ++k)
+                {
+                    std::size_t slot = detail::hash_name(names[sortedIndices[k]], seed) & (tableSize - 1);
+                    placed = result.slots[slot] < 0 && marks[slot] != attempt;
+                    marks[slot] = attempt;
+                }
+                if (placed)
+                {
+                    result.seeds[b] = seed;
+                    for (std::size_t k = bucketStarts[b]; k != bucketStarts[b + 1]; ++k)
+                    {
+                        std::size_t i = sortedIndices[k];
+                        result.slots[detail::hash_name(names[i], seed) & (tableSize - 1)] = gsl::index(i);
+                    }
+                }
+            }
+            if (!placed)
             {
-                return detail::tuple_cat_impl<TupleT>(
-                    std::forward<decltype(baseMemberTuples)>(baseMemberTuples)...,
-                    directMembers);
-            },
-            baseMemberTupleTuple);
+                result.is_perfect = false;
+                return result;
+            }
+        }
+    }
+    return result;
+}
+
+
+    // Metadata of `T` as returned by the reflector. Every accessor reads the metadata through this variable template, so the
+    // reflector is invoked only once per type.
+template <typename T, typename ReflectorT>
+constexpr inline auto raw_metadata_v = detail::get_metadata<T, ReflectorT>();
+
+
+template <template <typename...> class TupleT, typename... Ts, typename BaseMembersT, std::size_t... Is, std::size_t... Js>
+constexpr TupleT<std::tuple_element_t<Is, BaseMembersT>..., Ts...>
+prepend_members_0(BaseMembersT const& baseMembers, TupleT<Ts...> const& members, std::index_sequence<Is...>, std::index_sequence<Js...>)
+{
+    using std::get;
+    return { get<Is>(baseMembers)..., get<Js>(members)... };
+}
+template <typename BaseMembersT, typename MembersT>
+constexpr auto
+prepend_members(BaseMembersT const& baseMembers, MembersT const& members)
+{
+    return detail::prepend_members_0(baseMembers, members,
+        std::make_index_sequence<std::tuple_size_v<BaseMembersT>>{ }, std::make_index_sequence<std::tuple_size_v<MembersT>>{ });
+}
+
+template <typename V, std::size_t N, std::size_t M>
+constexpr std::array<V, N + M>
+prepend_member_metadata(std::array<V, N> const& baseMemberMetadata, std::array<V, M> const& memberMetadata)
+{
+    auto result = std::array<V, N + M>{ };
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        result[i] = baseMemberMetadata[i];
+    }
+    for (std::size_t i = 0; i != M; ++i)
+    {
+        result[N + i] = memberMetadata[i];
+    }
+    return result;
+}
+
+    // Canonical form of the metadata of a type: the bases, values, and members listed in the metadata and the names of values and
+    // members, or `std::nullopt` where not applicable. `members` and `member_names` include the members of bases.
+template <typename BasesT, typename ValuesT, typename ValueNamesT, typename ExclusiveMembersT, typename ExclusiveMemberNamesT, typename MembersT, typename MemberNamesT>
+struct metadata_record
+{
+    BasesT bases;
+    ValuesT values;
+    ValueNamesT value_names;
+    ExclusiveMembersT exclusive_members;
+    ExclusiveMemberNamesT exclusive_member_names;
+    MembersT members;
+    MemberNamesT member_names;
+};
+template <typename... Ts>
+constexpr metadata_record<Ts...>
+make_metadata_record_0(Ts const&... args)
+{
+    return { args... };
+}
+
+template <typename T, typename ReflectorT>
+constexpr auto
+make_metadata_record(void);
+
+    // The metadata record of every type is computed once and cached. The accessors in `metadata::` read from the cached record
+    // rather than searching the reflected metadata again.
+template <typename T, typename ReflectorT>
+constexpr inline auto metadata_record_v = detail::make_metadata_record<T, ReflectorT>();
+
+    // Prepends the members of bases [0, I) of `T` to `members`. The members of the bases, including the members of their own
+    // bases, are taken from their cached metadata records.
+template <typename ReflectorT, typename BasesT, std::size_t I, typename MembersT>
+constexpr auto
+prepend_base_members([[maybe_unused]] MembersT const& members)
+{
+    if constexpr (I == 0) return members;
+    else
+    {
+        using Base = typename std::tuple_element_t<I - 1, BasesT>::type;
+        constexpr auto const& baseMembers = metadata_record_v<Base, ReflectorT>.members;
+        if constexpr (detail::is_available(baseMembers))
+        {
+            return detail::prepend_base_members<ReflectorT, BasesT, I - 1>(detail::prepend_members(baseMembers, members));
+        }
+        else return std::nullopt;
+    }
+}
+template <typename ReflectorT, typename BasesT, std::size_t I, typename MemberNamesT>
+constexpr auto
+prepend_base_member_names([[maybe_unused]] MemberNamesT const& memberNames)
+{
+    if constexpr (I == 0) return memberNames;
+    else
+    {
+        using Base = typename std::tuple_element_t<I - 1, BasesT>::type;
+        constexpr auto const& baseMemberNames = metadata_record_v<Base, ReflectorT>.member_names;
+        if constexpr (detail::is_available(baseMemberNames))
+        {
+            return detail::prepend_base_member_names<ReflectorT, BasesT, I - 1>(detail::prepend_member_metadata(baseMemberNames, memberNames));
+        }
+        else return std::nullopt;
+    }
+}
+
+template <typename ReflectorT, typename BasesT, typename MembersT>
+constexpr auto
+all_members([[maybe_unused]] BasesT const& bases, [[maybe_unused]] MembersT const& members)
+{
+    if constexpr (is_available_v<BasesT> && is_available_v<MembersT>)
+    {
+        return detail::prepend_base_members<ReflectorT, BasesT, std::tuple_size_v<BasesT>>(members);
+    }
+    else return std::nullopt;
+}
+template <typename ReflectorT, typename BasesT, typename MemberNamesT>
+constexpr auto
+all_member_names([[maybe_unused]] BasesT const& bases, [[maybe_unused]] MemberNamesT const& memberNames)
+{
+    if constexpr (is_available_v<BasesT> && is_available_v<MemberNamesT>)
+    {
+        return detail::prepend_base_member_names<ReflectorT, BasesT, std::tuple_size_v<BasesT>>(memberNames);
     }
     else return std::nullopt;
 }
+
+template <typename T, typename ReflectorT>
+constexpr auto
+make_metadata_record(void)
+{
+    using StringArgs = type_sequence<std::string_view>;
+
+    constexpr auto const& md = raw_metadata_v<T, ReflectorT>;
+    auto bases = detail::extract_bases<T>(md);
+    auto exclusiveMembers = detail::extract_members<T>(md);
+    auto exclusiveMemberNames = detail::extract_member_metadata<T, std::string_view, detail::predicate_adaptor<std::is_convertible>::template type, 0, StringArgs>(md);
+    return detail::make_metadata_record_0(
+        bases,
+        detail::extract_values<T>(md),
+        detail::extract_value_metadata<T, std::string_view, detail::predicate_adaptor<std::is_convertible>::template type, 0, StringArgs>(md),
+        exclusiveMembers,
+        exclusiveMemberNames,
+        detail::all_members<ReflectorT>(bases, exclusiveMembers),
+        detail::all_member_names<ReflectorT>(bases, exclusiveMemberNames));
+}
+
+
+template <template <typename...> class TupleT, typename MembersT, std::size_t... Is>
+constexpr TupleT<std::tuple_element_t<Is, MembersT>...>
+convert_members_0(MembersT const& members, std::index_sequence<Is...>)
+{
+    using std::get;
+    return { get<Is>(members)... };
+}
+template <template <typename...> class TupleT, typename MembersT>
+constexpr auto
+convert_members([[maybe_unused]] MembersT const& members)
+{
+    if constexpr (is_available_v<MembersT>)
+    {
+        return detail::convert_members_0<TupleT>(members, std::make_index_sequence<std::tuple_size_v<MembersT>>{ });
+    }
+    else return std::nullopt;
+}
+
+    // All members of `T` as a tuple of type `TupleT<>`.
+template <template <typename...> class TupleT, typename T, typename ReflectorT>
+constexpr inline auto member_tuple_v = detail::convert_members<TupleT>(metadata_record_v<T, ReflectorT>.members);
+
 template <typename T, typename V, template <typename...> class PredT, int Occurrence, typename ArgsT, typename ReflectorT>
 constexpr decltype(auto)
 extract_all_member_metadata()
 {
-    constexpr auto directMemberMetadata = detail::extract_member_metadata<T, V, PredT, Occurrence, ArgsT>(
-        detail::get_metadata<T, ReflectorT>());
+    constexpr auto directMemberMetadata = detail::extract_member_metadata<T, V, PredT, Occurrence, ArgsT>(raw_metadata_v<T, ReflectorT>);
     if constexpr (detail::is_available(directMemberMetadata))
     {
         auto baseMemberMetadataArrayTuple = detail::apply_impl(
             [](auto&&... bases)
             {
                 return std::make_tuple(
-                    detail::extract_member_metadata<typename std::remove_cv_t<std::remove_reference_t<decltype(bases)>>::type, V, PredT, Occurrence, ArgsT>(
-                        detail::get_metadata<typename std::remove_cv_t<std::remove_reference_t<decltype(bases)>>::type, ReflectorT>())...);
+                    detail::extract_all_member_metadata<typename std::remove_cv_t<std::remove_reference_t<decltype(bases)>>::type, V, PredT, Occurrence, ArgsT, ReflectorT>()...);
             },
-            detail::extract_bases<T>(detail::get_metadata<T, ReflectorT>()));
+            metadata_record_v<T, ReflectorT>.bases);
         return detail::apply_impl(
             [&directMemberMetadata](auto&&... baseMemberMetadataArrays)
             {
@@ -545,42 +898,41 @@ extract_all_member_metadata()
     else return std::nullopt;
 }
 
+    // The results of predicate-parameterized extraction are cached for every combination of type, predicate, and occurrence, so
+    // the metadata is searched only once per combination.
+template <typename T, template <typename...> class PredT, int Occurrence, typename ArgsT, typename ReflectorT>
+constexpr inline auto extracted_metadata_v = detail::extract_metadata<void, PredT, Occurrence>(raw_metadata_v<T, ReflectorT>, ArgsT{ });
+template <typename T, typename V, template <typename...> class PredT, int Occurrence, typename ArgsT, typename ReflectorT>
+constexpr inline auto value_metadata_v = detail::extract_value_metadata<T, V, PredT, Occurrence, ArgsT>(raw_metadata_v<T, ReflectorT>);
+template <typename T, typename V, template <typename...> class PredT, int Occurrence, typename ArgsT, typename ReflectorT>
+constexpr inline auto exclusive_member_metadata_v = detail::extract_member_metadata<T, V, PredT, Occurrence, ArgsT>(raw_metadata_v<T, ReflectorT>);
+template <typename T, typename V, template <typename...> class PredT, int Occurrence, typename ArgsT, typename ReflectorT>
+constexpr inline auto member_metadata_v = detail::extract_all_member_metadata<T, V, PredT, Occurrence, ArgsT, ReflectorT>();
+
 template <typename T, typename ReflectorT>
-struct value_store
-{
-    static constexpr inline auto value = detail::extract_values<T>(detail::get_metadata<T, ReflectorT>());
-};
-template <typename T, typename ReflectorT>
-struct value_name_store
-{
-    static constexpr inline auto value = detail::extract_value_metadata<T, std::string_view,
-        detail::predicate_adaptor<std::is_convertible>::template type, 0, type_sequence<std::string_view>>(
-            detail::get_metadata<T, ReflectorT>());
-};
-template <typename T, typename ReflectorT>
-struct exclusive_member_store
-{
-    static constexpr inline auto value = detail::extract_members<T>(detail::get_metadata<T, ReflectorT>());
-};
+constexpr inline auto value_name_hash_index_v = detail::make_name_hash_index(metadata_record_v<T, ReflectorT>.value_names);
 template <typename T, typename ReflectorT>
-struct exclusive_member_name_store
-{
-    static constexpr inline auto value = detail::extract_member_metadata<T, std::string_view,
-        detail::predicate_adaptor<std::is_convertible>::template type, 0, type_sequence<std::string_view>>(
-            detail::get_metadata<T, ReflectorT>());
-};
-template <template <typename...> class TupleT, typename T, typename ReflectorT>
-struct member_store
-{
-    static constexpr inline auto value = detail::all_members<T, TupleT, ReflectorT>();
-};
+constexpr inline auto exclusive_member_name_hash_index_v = detail::make_name_hash_index(metadata_record_v<T, ReflectorT>.exclusive_member_names);
 template <typename T, typename ReflectorT>
-struct member_name_store
-{
-    static constexpr inline auto value = detail::extract_all_member_metadata<T, std::string_view,
-        detail::predicate_adaptor<std::is_convertible>::template type, 0, type_sequence<std::string_view>, ReflectorT>();
-};
+constexpr inline auto member_name_hash_index_v = detail::make_name_hash_index(metadata_record_v<T, ReflectorT>.member_names);
+
 
+template <typename T, typename ReflectorT, typename F, std::size_t... Is>
+constexpr auto
+make_member_visitor_table(std::index_sequence<Is...>) noexcept
+{
+    using Visitor = void (*)(T& obj, F& func);
+    return std::array<Visitor, sizeof...(Is)>{
+        [](T& obj, F& func)
+        {
+            using std::get;
+            func(obj.*get<Is>(metadata_record_v<std::remove_const_t<T>, ReflectorT>.members));
+        }...
+    };
+}
+template <typename T, typename ReflectorT, typename F>
+constexpr inline auto member_visitor_table_v = detail::make_member_visitor_table<T, ReflectorT, F>(
+    std::make_index_sequence<std::tuple_size_v<std::remove_const_t<decltype(metadata_record_v<std::remove_const_t<T>, ReflectorT>.members)>>>{ });
 
 } // namespace detail
 
@@ -10,7 +10,7 @@
 
 #include <gsl-lite/gsl-lite.hpp>  // for index, dim, ssize(), data(), size(), gsl_Expects()
 
-#include <makeshift/detail/macros.hpp>       // for MAKESHIFT_DETAIL_EMPTY_BASES, MAKESHIFT_DETAIL_FORCEINLINE
+#include <makeshift/detail/macros.hpp>       // for MAKESHIFT_DETAIL_EMPTY_BASES, MAKESHIFT_DETAIL_FORCEINLINE, MAKESHIFT_DETAIL_PREFETCH()
 #include <makeshift/detail/type_traits.hpp>  // for is_tuple_like<>, any_sink
 
 
@@ -299,6 +299,9 @@ struct MAKESHIFT_DETAIL_EMPTY_BASES zip_iterator_defaults
     {
         return { };
     }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr void _prefetch(gsl::index, std::ptrdiff_t) const noexcept
+    {
+    }
 };
 template <std::size_t I, typename R, iterator_mode IteratorMode>
 struct zip_iterator_leaf_base;
@@ -349,6 +352,9 @@ struct MAKESHIFT_DETAIL_EMPTY_BASES zip_iterator_leaf_base<I, R, iterator_mode::
     {
         return pos == end;
     }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr void _prefetch(gsl::index, std::ptrdiff_t) const noexcept
+    {
+    }
 };
 template <std::size_t I, typename R>
 struct MAKESHIFT_DETAIL_EMPTY_BASES zip_iterator_leaf_base<I, R, iterator_mode::iterator> : zip_iterator_defaults
@@ -405,6 +411,10 @@ struct MAKESHIFT_DETAIL_EMPTY_BASES zip_iterator_leaf_base<I, R, iterator_mode::
     {
         return data[i + d];
     }
+    MAKESHIFT_DETAIL_FORCEINLINE void _prefetch(gsl::index i, std::ptrdiff_t d) const noexcept
+    {
+        MAKESHIFT_DETAIL_PREFETCH(data + i + d);
+    }
 };
 template <std::size_t I, typename R>
 struct MAKESHIFT_DETAIL_EMPTY_BASES zip_iterator_leaf_base<I, R, iterator_mode::range_index> : zip_iterator_defaults
@@ -3,17 +3,22 @@
 #define INCLUDED_MAKESHIFT_EXPERIMENTAL_ALGORITHM_HPP_
 
 
+#include <vector>
 #include <utility>   // for swap()
 #include <iterator>  // for iterator_traits<>
 
-#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER
+#include <gsl-lite/gsl-lite.hpp>  // for index, gsl_Expects(), gsl_CPP17_OR_GREATER
 
 #if !gsl_CPP17_OR_GREATER
 # error makeshift requires C++17 mode or higher
 #endif // !gsl_CPP17_OR_GREATER
 
+#include <makeshift/metadata.hpp>  // for reflector
+
 #include <makeshift/detail/algorithm.hpp>
 
+#include <makeshift/experimental/detail/algorithm.hpp>
+
 
 namespace makeshift {
 
@@ -88,6 +93,49 @@ apply_reverse_permutation(RandomIt first, RandomIt last, IndexRandomIt indices)
 }
 
 
+    //
+    // Returns the permutation which stably sorts the records in the range [first, last) by the members given by the constval
+    // `membersC`, a tuple of member pointers. The permutation can be applied to the range or to associated ranges with
+    // `apply_permutation()`.
+    //ᅟ
+    //ᅟ    struct COO { std::int32_t i, j; double v; };
+    //ᅟ
+    //ᅟ    auto perm = sort_permutation_by_members(entries.begin(), entries.end(), MAKESHIFT_CONSTVAL(std::tuple{ &COO::i, &COO::j }));
+    //ᅟ    apply_permutation(values.begin(), values.end(), perm.begin());
+    //
+    // Records are ordered lexicographically by the given members as by `reflected_less<>`, except that floating-point values are
+    // ordered by their IEEE 754 total order, in which negative zero precedes positive zero and NaN values are ordered. Members may
+    // be of arithmetic type, enums (which are ordered by their underlying values), arrays, or types with reflected members.
+    // Instead of comparing records, the members are encoded as fixed-width byte keys as with `make_sort_key()`, which are then
+    // sorted with an LSD radix sort. Passes over key bytes that are identical for all records are skipped. A variant which runs the
+    // passes concurrently, `sort_permutation_by_members_parallel()`, is defined in <makeshift/experimental/parallel.hpp>.
+    //
+template <typename RandomIt, typename MembersC, typename ReflectorT = reflector>
+[[nodiscard]] std::vector<gsl::index>
+sort_permutation_by_members(RandomIt first, RandomIt last, MembersC membersC, ReflectorT = { })
+{
+    return detail::sort_permutation_by_members<detail::sequential_chunk_executor, ReflectorT>(first, last, membersC);
+}
+
+    //
+    // Stably sorts the records in the range [first, last) by the members given by the constval `membersC`, a tuple of member
+    // pointers.
+    //ᅟ
+    //ᅟ    sort_by_members(entries.begin(), entries.end(), MAKESHIFT_CONSTVAL(std::tuple{ &COO::i, &COO::j }));
+    //
+    // After the permutation has been determined with `sort_permutation_by_members()`, the records are moved to a temporary buffer
+    // in sorted order and then moved back. To sort a `soa_span<>` or other ranges with proxy reference types, apply the
+    // permutation with `apply_permutation()` instead.
+    //
+template <typename RandomIt, typename MembersC, typename ReflectorT = reflector>
+void
+sort_by_members(RandomIt first, RandomIt last, MembersC membersC, ReflectorT = { })
+{
+    auto permutation = detail::sort_permutation_by_members<detail::sequential_chunk_executor, ReflectorT>(first, last, membersC);
+    detail::gather_permutation(first, last, permutation);
+}
+
+
     //
     // Given a list of ranges, returns a range of tuples. The range returns a sentinel as end iterator.
     //ᅟ
@@ -0,0 +1,399 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_AOSOA_BUFFER_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_AOSOA_BUFFER_HPP_
+
+
+#include <tuple>
+#include <memory>           // for allocator<>, allocator_traits<>
+#include <cstddef>          // for size_t, ptrdiff_t, byte
+#include <utility>          // for move(), swap(), exchange(), index_sequence<>
+#include <type_traits>      // for is_const<>, is_reference<>, is_same<>, conjunction<>, disjunction<>, negation<>
+#include <memory_resource>  // for pmr::polymorphic_allocator<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/experimental/span.hpp>  // for soa_span<>
+
+#include <makeshift/experimental/detail/buffer.hpp>      // for allocator_holder<>, allocate_storage<>(), deallocate_storage<>()
+#include <makeshift/experimental/detail/soa_vector.hpp>  // for soa_default_alignment
+#include <makeshift/experimental/detail/aosoa_buffer.hpp>
+
+
+namespace makeshift {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Fixed-size array-of-structs-of-arrays buffer which stores the elements in tiles of `Tile` elements. Within a tile, the
+    // elements of every type `Ts...` are stored contiguously; the tiles are stored back to back in a single memory block obtained
+    // from `Allocator`.
+    //ᅟ
+    //ᅟ    auto particles = aosoa_buffer<8, double, double, float>(n);  // x, y, mass
+    //ᅟ    range_for(
+    //ᅟ        [](soa_span<double, double, float> tile)
+    //ᅟ        {
+    //ᅟ            auto [x, y, mass] = tile;  // spans of 8 elements each
+    //ᅟ            ...
+    //ᅟ        },
+    //ᅟ        particles.tiles());
+    //
+    // The last tile is padded to `Tile` elements. Padding elements are value-initialized, so kernels can operate on full tiles
+    // without a scalar remainder loop.
+    //
+    // The columns of every tile are aligned to `Alignment` bytes, which defaults to the size of a cache line for `aosoa_buffer<>`.
+    // Columns smaller than `Alignment` bytes are padded, so small tiles may waste memory unless a smaller alignment is chosen.
+    //
+    // Element-wise, the buffer offers the same span-of-tuples interface as `soa_span<>`.
+    //
+template <typename Allocator, std::size_t Tile, std::size_t Alignment, typename... Ts>
+class basic_aosoa_buffer : private detail::allocator_holder<Allocator>
+{
+    static_assert(Tile > 0, "tile size must be positive");
+    static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of 2");
+    static_assert(sizeof...(Ts) > 0, "struct-of-arrays container must have at least one column");
+    static_assert(std::conjunction_v<std::negation<std::disjunction<std::is_const<Ts>, std::is_reference<Ts>>>...>, "column types must not be const or reference types");
+    static_assert(std::is_same<typename std::allocator_traits<Allocator>::value_type, std::byte>::value, "allocator value type must be std::byte");
+
+private:
+    using Traits_ = std::allocator_traits<Allocator>;
+    using holder_ = detail::allocator_holder<Allocator>;
+    using layout_ = detail::aosoa_layout<Tile, Alignment, Ts...>;
+
+    static constexpr std::size_t alignment_ = layout_::block_alignment;
+
+    std::byte* block_;
+    std::size_t size_;
+
+    [[nodiscard]] Allocator& _allocator(void) noexcept
+    {
+        return holder_::allocator();
+    }
+    [[nodiscard]] static constexpr std::size_t _num_tiles(std::size_t size) noexcept
+    {
+        return (size + Tile - 1)/Tile;
+    }
+    [[nodiscard]] static constexpr std::size_t _block_size(std::size_t size) noexcept
+    {
+        return (_num_tiles(size)*layout_::tile_stride + alignment_ - 1)/alignment_*alignment_;
+    }
+
+    enum class source_ { none, copy, move };
+
+        // Constructs the element at index `i` by value-initialization, or by copying or moving the corresponding element in the
+        // memory block `src`. If a constructor throws, the members already constructed are destroyed.
+    template <source_ Source, std::size_t I = 0>
+    void _construct_element(std::size_t i, [[maybe_unused]] std::byte* src)
+    {
+        if constexpr (I != sizeof...(Ts))
+        {
+            auto dst = layout_::template element<I>(block_, i);
+            if constexpr (Source == source_::copy)
+            {
+                Traits_::construct(_allocator(), dst, std::as_const(*layout_::template element<I>(src, i)));
+            }
+            else if constexpr (Source == source_::move)
+            {
+                Traits_::construct(_allocator(), dst, std::move(*layout_::template element<I>(src, i)));
+            }
+            else
+            {
+                Traits_::construct(_allocator(), dst);
+            }
+            try
+            {
+                _construct_element<Source, I + 1>(i, src);
+            }
+            catch (...)
+            {
+                Traits_::destroy(_allocator(), dst);
+                throw;
+            }
+        }
+    }
+    template <std::size_t... Is>
+    void _destroy_element(std::size_t i, std::index_sequence<Is...>) noexcept
+    {
+        (Traits_::destroy(_allocator(), layout_::template element<Is>(block_, i)), ...);
+    }
+    void _destroy_elements(std::size_t n) noexcept
+    {
+        for (std::size_t i = n; i != 0; --i)
+        {
+            _destroy_element(i - 1, std::index_sequence_for<Ts...>{ });
+        }
+    }
+
+        // Allocates a memory block for `size` elements and constructs all elements including the padding elements, either by
+        // value-initialization or by copying or moving them from `src`.
+    template <source_ Source>
+    void _allocate(std::size_t size, std::byte* src)
+    {
+        if (size == 0) return;
+
+        std::size_t numElements = _num_tiles(size)*Tile;
+        block_ = detail::allocate_storage<std::byte, alignment_>(_allocator(), _block_size(size));
+        std::size_t i = 0;
+        try
+        {
+            for (; i != numElements; ++i)
+            {
+                _construct_element<Source>(i, src);
+            }
+        }
+        catch (...)
+        {
+            _destroy_elements(i);
+            detail::deallocate_storage<std::byte, alignment_>(_allocator(), block_, _block_size(size));
+            block_ = nullptr;
+            throw;
+        }
+        size_ = size;
+    }
+    void _release(void) noexcept
+    {
+        if (block_ != nullptr)
+        {
+            _destroy_elements(padded_size());
+            detail::deallocate_storage<std::byte, alignment_>(_allocator(), block_, _block_size(size_));
+        }
+        block_ = nullptr;
+        size_ = 0;
+    }
+
+public:
+    using allocator_type = Allocator;
+    using value_type = std::tuple<Ts...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::soa_reference<Ts...>;
+    using const_reference = detail::soa_reference<Ts const...>;
+    using iterator = detail::aosoa_iterator<false, Tile, Alignment, Ts...>;
+    using const_iterator = detail::aosoa_iterator<false, Tile, Alignment, Ts const...>;
+    using tile_range = detail::aosoa_tile_range<Tile, Alignment, Ts...>;
+    using const_tile_range = detail::aosoa_tile_range<Tile, Alignment, Ts const...>;
+
+    static constexpr std::size_t tile_size = Tile;
+
+    basic_aosoa_buffer(void) noexcept(noexcept(Allocator()))
+        : basic_aosoa_buffer(Allocator())
+    {
+    }
+    explicit basic_aosoa_buffer(Allocator const& alloc) noexcept
+        : holder_(alloc), block_(nullptr), size_(0)
+    {
+    }
+    explicit basic_aosoa_buffer(std::size_t size, Allocator const& alloc = Allocator())
+        : basic_aosoa_buffer(alloc)
+    {
+        _allocate<source_::none>(size, nullptr);
+    }
+    basic_aosoa_buffer(basic_aosoa_buffer const& rhs, Allocator const& alloc)
+        : basic_aosoa_buffer(alloc)
+    {
+        _allocate<source_::copy>(rhs.size_, rhs.block_);
+    }
+    basic_aosoa_buffer(basic_aosoa_buffer const& rhs)
+        : basic_aosoa_buffer(rhs, Traits_::select_on_container_copy_construction(rhs.get_allocator()))
+    {
+    }
+    basic_aosoa_buffer(basic_aosoa_buffer&& rhs) noexcept
+        : holder_(rhs._allocator()), block_(std::exchange(rhs.block_, nullptr)), size_(std::exchange(rhs.size_, 0))
+    {
+    }
+    basic_aosoa_buffer& operator =(basic_aosoa_buffer const& rhs)
+    {
+        if (this != &rhs)
+        {
+                // Copy the elements before releasing the current block so that the buffer is unchanged if copying throws.
+            auto copy = basic_aosoa_buffer(rhs, Traits_::propagate_on_container_copy_assignment::value ? rhs.get_allocator() : get_allocator());
+            _release();
+            if constexpr (Traits_::propagate_on_container_copy_assignment::value)
+            {
+                _allocator() = rhs.get_allocator();
+            }
+            block_ = std::exchange(copy.block_, nullptr);
+            size_ = std::exchange(copy.size_, 0);
+        }
+        return *this;
+    }
+    basic_aosoa_buffer& operator =(basic_aosoa_buffer&& rhs)
+        noexcept(Traits_::propagate_on_container_move_assignment::value || Traits_::is_always_equal::value)
+    {
+        if (this != &rhs)
+        {
+            if (Traits_::propagate_on_container_move_assignment::value || Traits_::is_always_equal::value || _allocator() == rhs._allocator())
+            {
+                _release();
+                if constexpr (Traits_::propagate_on_container_move_assignment::value)
+                {
+                    _allocator() = std::move(rhs._allocator());
+                }
+                block_ = std::exchange(rhs.block_, nullptr);
+                size_ = std::exchange(rhs.size_, 0);
+            }
+            else
+            {
+                    // The memory block cannot be taken over, so the elements are moved to a new block of our own allocator.
+                auto moved = basic_aosoa_buffer(_allocator());
+                moved.template _allocate<source_::move>(rhs.size_, rhs.block_);
+                rhs._release();
+                _release();
+                block_ = std::exchange(moved.block_, nullptr);
+                size_ = std::exchange(moved.size_, 0);
+            }
+        }
+        return *this;
+    }
+    ~basic_aosoa_buffer(void)
+    {
+        _release();
+    }
+
+    [[nodiscard]] Allocator get_allocator(void) const noexcept
+    {
+        return holder_::allocator();
+    }
+
+    [[nodiscard]] std::size_t size(void) const noexcept
+    {
+        return size_;
+    }
+    [[nodiscard]] bool empty(void) const noexcept
+    {
+        return size_ == 0;
+    }
+
+        //
+        // Returns the number of tiles.
+        //
+    [[nodiscard]] std::size_t num_tiles(void) const noexcept
+    {
+        return _num_tiles(size_);
+    }
+
+        //
+        // Returns the number of elements including the padding elements of the last tile.
+        //
+    [[nodiscard]] std::size_t padded_size(void) const noexcept
+    {
+        return _num_tiles(size_)*Tile;
+    }
+
+    [[nodiscard]] iterator begin(void) noexcept
+    {
+        return { block_, 0 };
+    }
+    [[nodiscard]] iterator end(void) noexcept
+    {
+        return { block_, difference_type(size_) };
+    }
+    [[nodiscard]] const_iterator begin(void) const noexcept
+    {
+        return { block_, 0 };
+    }
+    [[nodiscard]] const_iterator end(void) const noexcept
+    {
+        return { block_, difference_type(size_) };
+    }
+    [[nodiscard]] const_iterator cbegin(void) const noexcept
+    {
+        return { block_, 0 };
+    }
+    [[nodiscard]] const_iterator cend(void) const noexcept
+    {
+        return { block_, difference_type(size_) };
+    }
+
+    [[nodiscard]] reference operator [](std::size_t i)
+    {
+        gsl_Expects(i < size_);
+
+        return begin()[difference_type(i)];
+    }
+    [[nodiscard]] const_reference operator [](std::size_t i) const
+    {
+        gsl_Expects(i < size_);
+
+        return begin()[difference_type(i)];
+    }
+
+        //
+        // Returns a `soa_span<>` view of the `Tile` elements in tile `t`.
+        //
+    [[nodiscard]] soa_span<Ts...> tile(std::size_t t)
+    {
+        gsl_Expects(t < num_tiles());
+
+        return tiles().begin()[difference_type(t)];
+    }
+    [[nodiscard]] soa_span<Ts const...> tile(std::size_t t) const
+    {
+        gsl_Expects(t < num_tiles());
+
+        return tiles().begin()[difference_type(t)];
+    }
+
+        //
+        // Returns a range of the tiles. Every tile is represented by a `soa_span<>` view of `Tile` elements, including the
+        // padding elements of the last tile.
+        //ᅟ
+        //ᅟ    range_for(
+        //ᅟ        [](auto dst, auto src)
+        //ᅟ        {
+        //ᅟ            auto [dx, dy] = dst;
+        //ᅟ            auto [sx, sy] = src;
+        //ᅟ            for (gsl::index i = 0; i != sx.ssize(); ++i) { dx[i] = sx[i]; dy[i] = sy[i]; }
+        //ᅟ        },
+        //ᅟ        dst.tiles(), src.tiles());
+        //
+    [[nodiscard]] tile_range tiles(void) noexcept
+    {
+        return { block_, num_tiles() };
+    }
+    [[nodiscard]] const_tile_range tiles(void) const noexcept
+    {
+        return { block_, num_tiles() };
+    }
+
+    friend void swap(basic_aosoa_buffer& lhs, basic_aosoa_buffer& rhs) noexcept
+    {
+        using std::swap;
+        if constexpr (Traits_::propagate_on_container_swap::value)
+        {
+            swap(lhs._allocator(), rhs._allocator());
+        }
+        swap(lhs.block_, rhs.block_);
+        swap(lhs.size_, rhs.size_);
+    }
+};
+
+    //
+    // Array-of-structs-of-arrays buffer with tiles of `Tile` elements.
+    //
+template <std::size_t Tile, typename... Ts>
+using aosoa_buffer = basic_aosoa_buffer<std::allocator<std::byte>, Tile, detail::soa_default_alignment, Ts...>;
+
+
+namespace pmr {
+
+
+    //
+    // Array-of-structs-of-arrays buffer with tiles of `Tile` elements which obtains its memory from a `std::pmr::memory_resource`.
+    //
+template <std::size_t Tile, typename... Ts>
+using aosoa_buffer = basic_aosoa_buffer<std::pmr::polymorphic_allocator<std::byte>, Tile, detail::soa_default_alignment, Ts...>;
+
+
+} // namespace pmr
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_AOSOA_BUFFER_HPP_
@@ -4,12 +4,14 @@
 
 
 #include <array>
-#include <utility>      // for tuple_size<>, tuple_element<>
-#include <iterator>     // for move_iterator<>
-#include <algorithm>    // for copy()
-#include <type_traits>  // for is_convertible<>
+#include <memory>           // for allocator<>, allocator_traits<>
+#include <utility>          // for tuple_size<>, tuple_element<>
+#include <memory_resource>  // for pmr::polymorphic_allocator<>
+#include <iterator>         // for move_iterator<>
+#include <algorithm>        // for copy(), fill()
+#include <type_traits>      // for is_convertible<>, is_trivially_default_constructible<>, is_nothrow_move_constructible<>, is_nothrow_move_assignable<>
 
-#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER
+#include <gsl-lite/gsl-lite.hpp>  // for span<>, gsl_Expects(), gsl_CPP17_OR_GREATER
 
 #if !gsl_CPP17_OR_GREATER
 # error makeshift requires C++17 mode or higher
@@ -27,8 +29,16 @@ namespace gsl = ::gsl_lite;
 constexpr std::ptrdiff_t dynamic_extent = -1;
 
 
-// TODO: have `buffer<>` support allocators
-// TODO: introduce `row_buffer<>`
+    //
+    // Pass `default_init` to the constructor of `buffer<>` or `fixed_buffer<>` to have the elements default-initialized rather
+    // than value-initialized. Elements of trivially default-constructible types are thus left uninitialized, which avoids
+    // touching the memory twice if the buffer is going to be overwritten anyway.
+    //ᅟ
+    //ᅟ    auto buf = buffer<double>(numElements, default_init); // elements have indeterminate values
+    //ᅟ    std::copy(first, last, buf.begin());
+    //
+static constexpr inline detail::default_init_t
+default_init{ };
 
 
     //
@@ -37,6 +47,12 @@ constexpr std::ptrdiff_t dynamic_extent = -1;
     // The buffer stores `Extent` elements. If `Extent == dynamic_extent`, the number of elements is determined at runtime.
     // The buffer allocates the elements in-place if the number of elements is smaller than `MaxStaticBufferExtent`, and on the heap otherwise.
     // If `MaxStaticBufferExtent == -1`, the elements are allocated in-place if `Extent != dynamic_extent`, and on the heap otherwise.
+    // Heap storage is obtained from an allocator of type `Allocator`, which is ignored if the elements are allocated in-place.
+    // The storage is aligned to `Alignment` bytes. If `Alignment > alignof(T)`, the storage is padded with value-initialized elements
+    // such that its size is a multiple of `Alignment` bytes; `padded_size()` returns the number of elements including the padding.
+    // Padding is thus tied to over-alignment rather than being a separate option: kernels which process the storage in aligned
+    // vectors of `Alignment` bytes can then handle the tail without a scalar remainder loop. With the default `Alignment`, no
+    // padding is added.
     //ᅟ
     //ᅟ    std::size_t numElements = ...;
     //ᅟ    auto buf = make_buffer<float>(numElements); // returns `buffer<float, dynamic_extent>`; allocates on the heap
@@ -44,27 +60,40 @@ constexpr std::ptrdiff_t dynamic_extent = -1;
     //ᅟ    auto numElementsC = std::integral_constant<std::size_t, N>{ };
     //ᅟ    auto buf = make_buffer<float>(numElementsC); // returns `buffer<float, N>`; allocates in-place
     //ᅟ    auto buf = make_buffer<float, 16>(numElementsC); // returns `buffer<float, N, 16>`; allocates on the heap if `N > 16`
+    //ᅟ    auto buf = make_buffer<float>(numElements, arena_allocator<float>(arena)); // returns `buffer<float, dynamic_extent, -1, arena_allocator<float>>`
+    //ᅟ    auto buf = make_buffer<float, -1, 64>(numElements); // returns `buffer<float, dynamic_extent, -1, std::allocator<float>, 64>`; storage is aligned to 64 bytes and padded to a multiple of 16 elements
     //
-template <typename T, std::ptrdiff_t Extent = dynamic_extent, std::ptrdiff_t MaxStaticBufferExtent = -1>
+template <typename T, std::ptrdiff_t Extent = dynamic_extent, std::ptrdiff_t MaxStaticBufferExtent = -1, typename Allocator = std::allocator<T>, std::size_t Alignment = alignof(T)>
 class buffer
-    : public detail::buffer_base<T, Extent, MaxStaticBufferExtent, detail::determine_memory_location(Extent, MaxStaticBufferExtent)>
+    : public detail::buffer_base<T, Extent, MaxStaticBufferExtent, Allocator, Alignment, detail::determine_memory_location(Extent, MaxStaticBufferExtent)>
 {
 private:
-    using base_ = detail::buffer_base<T, Extent, MaxStaticBufferExtent, detail::determine_memory_location(Extent, MaxStaticBufferExtent)>;
+    using base_ = detail::buffer_base<T, Extent, MaxStaticBufferExtent, Allocator, Alignment, detail::determine_memory_location(Extent, MaxStaticBufferExtent)>;
 
 public:
+    using allocator_type = Allocator;
+
     template <typename ExtentC,
               std::enable_if_t<std::is_convertible<ExtentC, std::size_t>::value, int> = 0>
-    explicit constexpr buffer(ExtentC extent)
-        : base_(extent)
+    explicit constexpr buffer(ExtentC extent, Allocator const& alloc = Allocator())
+        : base_(extent, alloc)
+    {
+        constexpr std::ptrdiff_t rhsExtent = detail::buffer_extent_from_constval(ExtentC{ });
+        static_assert(Extent == dynamic_extent || rhsExtent == -1 || Extent == rhsExtent, "static extents must match");
+        detail::check_buffer_extents(std::integral_constant<bool, Extent == dynamic_extent>{ }, Extent, extent);
+    }
+    template <typename ExtentC,
+              std::enable_if_t<std::is_convertible<ExtentC, std::size_t>::value, int> = 0>
+    buffer(ExtentC extent, detail::default_init_t, Allocator const& alloc = Allocator())
+        : base_(extent, detail::default_init_t{ }, alloc)
     {
         constexpr std::ptrdiff_t rhsExtent = detail::buffer_extent_from_constval(ExtentC{ });
         static_assert(Extent == dynamic_extent || rhsExtent == -1 || Extent == rhsExtent, "static extents must match");
         detail::check_buffer_extents(std::integral_constant<bool, Extent == dynamic_extent>{ }, Extent, extent);
     }
     template <std::ptrdiff_t RExtent, typename U>
-    constexpr buffer(U (&&array)[RExtent])
-        : base_(RExtent)
+    constexpr buffer(U (&&array)[RExtent], Allocator const& alloc = Allocator())
+        : base_(RExtent, alloc)
     {
         static_assert(Extent == dynamic_extent || RExtent == Extent, "array extent does not match");
         static_assert(std::is_convertible<U, T>::value, "incompatible array element types");
@@ -109,27 +138,83 @@ make_buffer(C size)
     //ᅟ
     // If `MaxStaticBufferExtent >= 0`, the elements are allocated in-place if `size <= MaxStaticBufferExtent`, and on the heap otherwise.
     // If `MaxStaticBufferExtent == -1`, the elements are allocated in-place if `size` is a constval, and on the heap otherwise.
+    // The storage is aligned to `Alignment` bytes and padded accordingly.
     //ᅟ
     //ᅟ    std::size_t numElements = ...;
     //ᅟ    auto buf = make_buffer<float, 16>(numElements); // returns `buffer<float, dynamic_extent, 16>`; allocates on the heap if `numElements > 16`
     //ᅟ    auto numElementsC = std::integral_constant<std::size_t, N>{ };
     //ᅟ    auto buf = make_buffer<float, 16>(numElementsC); // returns `buffer<float, N, 16>`; allocates on the heap if `N > 16`
+    //ᅟ    auto buf = make_buffer<float, 16, 32>(numElements); // returns `buffer<float, dynamic_extent, 16, std::allocator<float>, 32>`
     //
-template <typename T, std::ptrdiff_t MaxStaticBufferExtent,
+template <typename T, std::ptrdiff_t MaxStaticBufferExtent, std::size_t Alignment = alignof(T),
           typename C>
 [[nodiscard]] constexpr
-buffer<T, detail::buffer_extent_from_constval(C{ }), MaxStaticBufferExtent>
+buffer<T, detail::buffer_extent_from_constval(C{ }), MaxStaticBufferExtent, std::allocator<T>, Alignment>
 make_buffer(C size)
 {
-    return buffer<T, detail::buffer_extent_from_constval(C{ }), MaxStaticBufferExtent>(size);
+    return buffer<T, detail::buffer_extent_from_constval(C{ }), MaxStaticBufferExtent, std::allocator<T>, Alignment>(size);
 }
 
 
+    //
+    // Construct array-like container with configurable small-buffer optimization which obtains heap storage from the given allocator.
+    //ᅟ
+    // The number of elements is allocated in-place if `size` is a constval, and with the allocator otherwise. The allocator is
+    // rebound to the element type `T`.
+    //ᅟ
+    //ᅟ    auto arena = monotonic_arena();
+    //ᅟ    auto buf = make_buffer<float>(numElements, arena_allocator<float>(arena)); // returns `buffer<float, dynamic_extent, -1, arena_allocator<float>>`
+    //ᅟ    auto buf = make_buffer<float>(numElements, std::pmr::polymorphic_allocator<float>(&resource)); // returns `pmr::buffer<float>`
+    //
+template <typename T,
+          typename C, typename A>
+[[nodiscard]] constexpr
+buffer<T, detail::buffer_extent_from_constval(C{ }), -1, typename std::allocator_traits<A>::template rebind_alloc<T>>
+make_buffer(C size, A const& alloc)
+{
+    return buffer<T, detail::buffer_extent_from_constval(C{ }), -1, typename std::allocator_traits<A>::template rebind_alloc<T>>(size, alloc);
+}
+
+    //
+    // Construct array-like container with configurable small-buffer optimization which obtains heap storage from the given allocator.
+    //ᅟ
+    // If `MaxStaticBufferExtent >= 0`, the elements are allocated in-place if `size <= MaxStaticBufferExtent`, and with the allocator otherwise.
+    // If `MaxStaticBufferExtent == -1`, the elements are allocated in-place if `size` is a constval, and with the allocator otherwise.
+    // The allocator is rebound to the element type `T`. The storage is aligned to `Alignment` bytes and padded accordingly.
+    //ᅟ
+    //ᅟ    auto buf = make_buffer<float, 16>(numElements, pool_allocator<float>{ }); // returns `buffer<float, dynamic_extent, 16, pool_allocator<float>>`
+    //
+template <typename T, std::ptrdiff_t MaxStaticBufferExtent, std::size_t Alignment = alignof(T),
+          typename C, typename A>
+[[nodiscard]] constexpr
+buffer<T, detail::buffer_extent_from_constval(C{ }), MaxStaticBufferExtent, typename std::allocator_traits<A>::template rebind_alloc<T>, Alignment>
+make_buffer(C size, A const& alloc)
+{
+    return buffer<T, detail::buffer_extent_from_constval(C{ }), MaxStaticBufferExtent, typename std::allocator_traits<A>::template rebind_alloc<T>, Alignment>(size, alloc);
+}
+
+
+namespace pmr {
+
+
+    //
+    // Array-like container with configurable small-buffer optimization which obtains heap storage from a `std::pmr::memory_resource`.
+    //ᅟ
+    //ᅟ    auto resource = std::pmr::monotonic_buffer_resource();
+    //ᅟ    auto buf = pmr::buffer<float>(numElements, &resource);
+    //
+template <typename T, std::ptrdiff_t Extent = dynamic_extent, std::ptrdiff_t MaxStaticBufferExtent = -1, std::size_t Alignment = alignof(T)>
+using buffer = makeshift::buffer<T, Extent, MaxStaticBufferExtent, std::pmr::polymorphic_allocator<T>, Alignment>;
+
+
+} // namespace pmr
+
     //
     // Array-like container with in-place storage.
     //ᅟ
     // The buffer stores `Extent` elements. If `Extent == dynamic_extent`, the number of elements is determined at runtime.
     // Buffer construction fails if the number of elements exceeds `MaxStaticBufferExtent`.
+    // The storage is aligned to `Alignment` bytes and padded with value-initialized elements if `Alignment > alignof(T)`.
     //ᅟ
     //ᅟ    std::size_t numElements = ...;
     //ᅟ    auto buf = make_fixed_buffer<float, 16>(numElements); // returns `fixed_buffer<float, dynamic_extent, 16>`; asserts that `numElements <= 16`
@@ -137,15 +222,15 @@ make_buffer(C size)
     //ᅟ    auto buf = make_fixed_buffer<float>(numElementsC); // returns `fixed_buffer<float, N, N>`
     //ᅟ    auto buf = make_fixed_buffer<float, 16>(numElementsC); // returns `fixed_buffer<float, N, 16>`; asserts at compile-time that `N <= 16`
     //
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent>
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment = alignof(T)>
 class fixed_buffer
-    : public detail::static_buffer_base<T, Extent, MaxBufferExtent>
+    : public detail::static_buffer_base<T, Extent, MaxBufferExtent, Alignment>
 {
     static_assert(MaxBufferExtent >= 0, "invalid maximal buffer extent");
     static_assert(Extent <= MaxBufferExtent, "size exceeds buffer extent");
 
 private:
-    using base_ = detail::static_buffer_base<T, Extent, MaxBufferExtent>;
+    using base_ = detail::static_buffer_base<T, Extent, MaxBufferExtent, Alignment>;
 
 public:
     template <typename ExtentC,
@@ -158,6 +243,16 @@ public:
         static_assert(rhsExtent == -1 || rhsExtent <= MaxBufferExtent, "size exceeds buffer extent");
         detail::check_fixed_buffer_extents(std::integral_constant<bool, Extent == dynamic_extent>{ }, Extent, extent, MaxBufferExtent);
     }
+    template <typename ExtentC,
+              std::enable_if_t<std::is_convertible<ExtentC, std::size_t>::value, int> = 0>
+    fixed_buffer(ExtentC extent, detail::default_init_t)
+        : base_(extent, detail::default_init_t{ })
+    {
+        constexpr std::ptrdiff_t rhsExtent = detail::buffer_extent_from_constval(ExtentC{ });
+        static_assert(Extent == dynamic_extent || rhsExtent == -1 || Extent == rhsExtent, "static extents must match");
+        static_assert(rhsExtent == -1 || rhsExtent <= MaxBufferExtent, "size exceeds buffer extent");
+        detail::check_fixed_buffer_extents(std::integral_constant<bool, Extent == dynamic_extent>{ }, Extent, extent, MaxBufferExtent);
+    }
     template <std::ptrdiff_t RExtent, typename U>
     constexpr fixed_buffer(U (&&array)[RExtent])
         : base_(RExtent)
@@ -204,44 +299,365 @@ make_fixed_buffer(std::integral_constant<SizeT, Size>)
     //ᅟ    auto buf = make_fixed_buffer<float, 16>(numElements); // returns `fixed_buffer<float, dynamic_extent, 16>`; asserts that `numElements <= 16`
     //ᅟ    auto numElementsC = std::integral_constant<std::size_t, N>{ };
     //ᅟ    auto buf = make_fixed_buffer<float, 16>(numElementsC); // returns `fixed_buffer<float, N, 16>`; asserts at compile-time that `N <= 16`
+    //ᅟ    auto buf = make_fixed_buffer<float, 16, 32>(numElements); // returns `fixed_buffer<float, dynamic_extent, 16, 32>`
     //
-template <typename T, std::ptrdiff_t MaxBufferExtent,
+template <typename T, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment = alignof(T),
           typename C>
 [[nodiscard]] constexpr
-fixed_buffer<T, detail::buffer_extent_from_constval(C{ }), MaxBufferExtent>
+fixed_buffer<T, detail::buffer_extent_from_constval(C{ }), MaxBufferExtent, Alignment>
 make_fixed_buffer(C size)
 {
-    return fixed_buffer<T, detail::buffer_extent_from_constval(C{ }), MaxBufferExtent>(size);
+    return fixed_buffer<T, detail::buffer_extent_from_constval(C{ }), MaxBufferExtent, Alignment>(size);
+}
+
+
+    //
+    // Two-dimensional array-like container which stores its elements row by row in a single allocation.
+    //ᅟ
+    // The buffer stores `Rows` rows of `Cols` elements each; either extent may be `dynamic_extent`. The storage is obtained
+    // as with `buffer<>`: the elements are allocated in-place if `Rows` and `Cols` are both known at compile time, or if the total
+    // number of elements including padding does not exceed `MaxStaticBufferExtent >= 0`, and from an allocator of type
+    // `Allocator` otherwise.
+    //ᅟ
+    // Every row is aligned to `Alignment` bytes. If `Alignment > alignof(T)`, rows are padded with value-initialized elements;
+    // the distance between the beginnings of two consecutive rows is `leading_dimension() >= cols()` elements.
+    //ᅟ
+    // If both extents are static but the elements are stored on the heap, a moved-from buffer has no storage and may only be
+    // assigned to or destroyed.
+    //ᅟ
+    // A `row_buffer<>` is a range of rows, which are represented as spans, and can thus be passed to `range_for()`:
+    //ᅟ
+    //ᅟ    auto A = make_row_buffer<double, -1, 32>(numRows, numCols); // returns `row_buffer<double, dynamic_extent, dynamic_extent, -1, std::allocator<double>, 32>`
+    //ᅟ    range_for(
+    //ᅟ        [](gsl::span<double> row) { std::fill(row.begin(), row.end(), 1.); },
+    //ᅟ        A);
+    //ᅟ    for (auto&& [x, y] : make_soa_span(A.row(0), A.row(1))) { ... }
+    //ᅟ    A(i, j) = 2.;
+    //
+template <typename T, std::ptrdiff_t Rows = dynamic_extent, std::ptrdiff_t Cols = dynamic_extent, std::ptrdiff_t MaxStaticBufferExtent = -1, typename Allocator = std::allocator<T>, std::size_t Alignment = alignof(T)>
+class row_buffer
+{
+    static_assert(Rows >= -1 && Cols >= -1, "invalid buffer extent");
+
+private:
+    static constexpr std::ptrdiff_t leadingDimension_ = detail::row_buffer_leading_dimension<T, Alignment>(Cols);
+    static constexpr std::ptrdiff_t storageExtent_ = Rows != dynamic_extent && Cols != dynamic_extent ? Rows*leadingDimension_ : dynamic_extent;
+
+    std::size_t rows_;
+    std::size_t cols_;
+    buffer<T, storageExtent_, MaxStaticBufferExtent, Allocator, Alignment> storage_;
+
+    [[nodiscard]] static constexpr std::size_t _leading_dimension(std::size_t cols) noexcept
+    {
+        if constexpr (Cols != dynamic_extent)
+        {
+            return std::size_t(leadingDimension_);
+        }
+        else
+        {
+            return detail::padded_buffer_size<T, Alignment>(cols);
+        }
+    }
+    template <typename RowsC, typename ColsC>
+    static constexpr void _check_extents(RowsC rows, ColsC cols)
+    {
+        constexpr std::ptrdiff_t rhsRows = detail::buffer_extent_from_constval(RowsC{ });
+        constexpr std::ptrdiff_t rhsCols = detail::buffer_extent_from_constval(ColsC{ });
+        static_assert(Rows == dynamic_extent || rhsRows == -1 || Rows == rhsRows, "static extents must match");
+        static_assert(Cols == dynamic_extent || rhsCols == -1 || Cols == rhsCols, "static extents must match");
+        detail::check_buffer_extents(std::integral_constant<bool, Rows == dynamic_extent>{ }, Rows, rows);
+        detail::check_buffer_extents(std::integral_constant<bool, Cols == dynamic_extent>{ }, Cols, cols);
+    }
+    void _value_initialize_row_padding(void) noexcept
+    {
+        if constexpr (std::is_trivially_default_constructible<T>::value && Alignment > alignof(T))
+        {
+            std::size_t ld = leading_dimension();
+            for (std::size_t i = 0; i != rows_; ++i)
+            {
+                std::fill(storage_.data() + i*ld + cols_, storage_.data() + (i + 1)*ld, T{ });
+            }
+        }
+    }
+
+        // A moved-from buffer with heap storage is empty; adjust the extents accordingly. If both extents are static, they cannot
+        // be adjusted, and the moved-from buffer may only be assigned to or destroyed.
+    void _reset_moved_from(void) noexcept
+    {
+        if constexpr (storageExtent_ == dynamic_extent)
+        {
+            if (storage_.size() == 0)
+            {
+                if constexpr (Rows == dynamic_extent) rows_ = 0;
+                else cols_ = 0;
+            }
+        }
+    }
+    [[nodiscard]] T* _data(void) noexcept
+    {
+        gsl_Expects(storage_.size() == padded_size());  // the buffer must not be in a moved-from state
+
+        return storage_.data();
+    }
+    [[nodiscard]] T const* _data(void) const noexcept
+    {
+        gsl_Expects(storage_.size() == padded_size());  // the buffer must not be in a moved-from state
+
+        return storage_.data();
+    }
+
+public:
+    using allocator_type = Allocator;
+    using value_type = gsl::span<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = gsl::span<T>;
+    using const_reference = gsl::span<T const>;
+    using iterator = detail::row_buffer_iterator<T>;
+    using const_iterator = detail::row_buffer_iterator<T const>;
+
+    template <typename RowsC, typename ColsC,
+              std::enable_if_t<std::is_convertible<RowsC, std::size_t>::value && std::is_convertible<ColsC, std::size_t>::value, int> = 0>
+    row_buffer(RowsC rows, ColsC cols, Allocator const& alloc = Allocator())
+        : rows_((_check_extents(rows, cols), std::size_t(rows))), cols_(std::size_t(cols)), storage_(std::ptrdiff_t(rows_*_leading_dimension(cols_)), alloc)
+    {
+    }
+    template <typename RowsC, typename ColsC,
+              std::enable_if_t<std::is_convertible<RowsC, std::size_t>::value && std::is_convertible<ColsC, std::size_t>::value, int> = 0>
+    row_buffer(RowsC rows, ColsC cols, detail::default_init_t, Allocator const& alloc = Allocator())
+        : rows_((_check_extents(rows, cols), std::size_t(rows))), cols_(std::size_t(cols)), storage_(std::ptrdiff_t(rows_*_leading_dimension(cols_)), detail::default_init_t{ }, alloc)
+    {
+        _value_initialize_row_padding();
+    }
+    row_buffer(row_buffer const&) = default;
+    row_buffer(row_buffer&& rhs) noexcept(std::is_nothrow_move_constructible<decltype(storage_)>::value)
+        : rows_(rhs.rows_), cols_(rhs.cols_), storage_(std::move(rhs.storage_))
+    {
+        rhs._reset_moved_from();
+    }
+    row_buffer& operator =(row_buffer const& rhs)
+    {
+        if (this != &rhs)
+        {
+                // Copy the storage first so the extents remain unchanged if copying throws.
+            storage_ = rhs.storage_;
+            rows_ = rhs.rows_;
+            cols_ = rhs.cols_;
+        }
+        return *this;
+    }
+    row_buffer& operator =(row_buffer&& rhs) noexcept(std::is_nothrow_move_assignable<decltype(storage_)>::value)
+    {
+        if (this != &rhs)
+        {
+            storage_ = std::move(rhs.storage_);
+            rows_ = rhs.rows_;
+            cols_ = rhs.cols_;
+            rhs._reset_moved_from();
+        }
+        return *this;
+    }
+
+        //
+        // Returns the number of rows.
+        //
+    [[nodiscard]] constexpr std::size_t
+    rows(void) const noexcept
+    {
+        if constexpr (Rows != dynamic_extent) return std::size_t(Rows);
+        else return rows_;
+    }
+        //
+        // Returns the number of elements in a row.
+        //
+    [[nodiscard]] constexpr std::size_t
+    cols(void) const noexcept
+    {
+        if constexpr (Cols != dynamic_extent) return std::size_t(Cols);
+        else return cols_;
+    }
+        //
+        // Returns the distance between the beginnings of two consecutive rows in elements.
+        //
+    [[nodiscard]] constexpr std::size_t
+    leading_dimension(void) const noexcept
+    {
+        return _leading_dimension(cols_);
+    }
+
+        //
+        // Returns the number of rows. Together with `begin()` and `end()`, this makes the buffer a range of rows.
+        //
+    [[nodiscard]] constexpr std::size_t
+    size(void) const noexcept
+    {
+        return rows();
+    }
+    [[nodiscard]] constexpr bool
+    empty(void) const noexcept
+    {
+        return rows() == 0;
+    }
+        //
+        // Returns the number of elements in the storage, including row padding.
+        //
+    [[nodiscard]] constexpr std::size_t
+    padded_size(void) const noexcept
+    {
+        return rows()*leading_dimension();
+    }
+
+        //
+        // Returns a span of all elements in the storage, including row padding. (The buffer deliberately has no `data()` member
+        // because it is a range of rows, not of elements.)
+        //
+    [[nodiscard]] gsl::span<T>
+    elements(void) noexcept
+    {
+        return { _data(), padded_size() };
+    }
+    [[nodiscard]] gsl::span<T const>
+    elements(void) const noexcept
+    {
+        return { _data(), padded_size() };
+    }
+
+    [[nodiscard]] gsl::span<T>
+    row(std::size_t i)
+    {
+        gsl_Expects(i < rows());
+
+        return { _data() + i*leading_dimension(), cols() };
+    }
+    [[nodiscard]] gsl::span<T const>
+    row(std::size_t i) const
+    {
+        gsl_Expects(i < rows());
+
+        return { _data() + i*leading_dimension(), cols() };
+    }
+    [[nodiscard]] gsl::span<T>
+    operator [](std::size_t i)
+    {
+        return row(i);
+    }
+    [[nodiscard]] gsl::span<T const>
+    operator [](std::size_t i) const
+    {
+        return row(i);
+    }
+    [[nodiscard]] T&
+    operator ()(std::size_t i, std::size_t j)
+    {
+        gsl_Expects(i < rows() && j < cols());
+
+        return _data()[i*leading_dimension() + j];
+    }
+    [[nodiscard]] T const&
+    operator ()(std::size_t i, std::size_t j) const
+    {
+        gsl_Expects(i < rows() && j < cols());
+
+        return _data()[i*leading_dimension() + j];
+    }
+
+    [[nodiscard]] iterator
+    begin(void) noexcept
+    {
+        return { _data(), 0, std::ptrdiff_t(leading_dimension()), cols() };
+    }
+    [[nodiscard]] iterator
+    end(void) noexcept
+    {
+        return { _data(), std::ptrdiff_t(rows()), std::ptrdiff_t(leading_dimension()), cols() };
+    }
+    [[nodiscard]] const_iterator
+    begin(void) const noexcept
+    {
+        return { _data(), 0, std::ptrdiff_t(leading_dimension()), cols() };
+    }
+    [[nodiscard]] const_iterator
+    end(void) const noexcept
+    {
+        return { _data(), std::ptrdiff_t(rows()), std::ptrdiff_t(leading_dimension()), cols() };
+    }
+    [[nodiscard]] const_iterator
+    cbegin(void) const noexcept
+    {
+        return begin();
+    }
+    [[nodiscard]] const_iterator
+    cend(void) const noexcept
+    {
+        return end();
+    }
+};
+
+    //
+    // Construct two-dimensional array-like container which stores its elements row by row in a single allocation.
+    //ᅟ
+    // Extents passed as constvals become static extents. The storage is allocated in-place if both extents are constvals or if
+    // the number of elements including row padding does not exceed `MaxStaticBufferExtent >= 0`, and on the heap otherwise.
+    // Every row is aligned to `Alignment` bytes.
+    //ᅟ
+    //ᅟ    auto A = make_row_buffer<float>(numRows, numCols); // returns `row_buffer<float>`; allocates on the heap
+    //ᅟ    auto numColsC = std::integral_constant<std::size_t, 3>{ };
+    //ᅟ    auto B = make_row_buffer<float, 64>(numRows, numColsC); // returns `row_buffer<float, dynamic_extent, 3, 64>`; allocates on the heap if `numRows*3 > 64`
+    //ᅟ    auto C = make_row_buffer<float, -1, 32>(numRows, numCols); // every row starts at a 32-byte boundary
+    //
+template <typename T, std::ptrdiff_t MaxStaticBufferExtent = -1, std::size_t Alignment = alignof(T),
+          typename RowsC, typename ColsC>
+[[nodiscard]]
+row_buffer<T, detail::buffer_extent_from_constval(RowsC{ }), detail::buffer_extent_from_constval(ColsC{ }), MaxStaticBufferExtent, std::allocator<T>, Alignment>
+make_row_buffer(RowsC rows, ColsC cols)
+{
+    return row_buffer<T, detail::buffer_extent_from_constval(RowsC{ }), detail::buffer_extent_from_constval(ColsC{ }), MaxStaticBufferExtent, std::allocator<T>, Alignment>(rows, cols);
+}
+
+    //
+    // Construct two-dimensional array-like container which stores its elements row by row in a single allocation and obtains
+    // heap storage from the given allocator. The allocator is rebound to the element type `T`.
+    //ᅟ
+    //ᅟ    auto A = make_row_buffer<float>(numRows, numCols, arena_allocator<float>(arena));
+    //
+template <typename T, std::ptrdiff_t MaxStaticBufferExtent = -1, std::size_t Alignment = alignof(T),
+          typename RowsC, typename ColsC, typename A>
+[[nodiscard]]
+row_buffer<T, detail::buffer_extent_from_constval(RowsC{ }), detail::buffer_extent_from_constval(ColsC{ }), MaxStaticBufferExtent, typename std::allocator_traits<A>::template rebind_alloc<T>, Alignment>
+make_row_buffer(RowsC rows, ColsC cols, A const& alloc)
+{
+    using Alloc = typename std::allocator_traits<A>::template rebind_alloc<T>;
+    return row_buffer<T, detail::buffer_extent_from_constval(RowsC{ }), detail::buffer_extent_from_constval(ColsC{ }), MaxStaticBufferExtent, Alloc, Alignment>(rows, cols, Alloc(alloc));
 }
 
 
     // Implement tuple-like protocol for `buffer<>`.
-template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent>
+template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment>
 [[nodiscard]] constexpr std::enable_if_t<Extent != dynamic_extent, T&>
-get(buffer<T, Extent, MaxStaticBufferExtent>& buffer) noexcept
+get(buffer<T, Extent, MaxStaticBufferExtent, A, Alignment>& buffer) noexcept
 {
     static_assert(I < Extent, "index out of range");
     return buffer[I];
 }
-template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent>
+template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment>
 [[nodiscard]] constexpr std::enable_if_t<Extent != dynamic_extent, T const&>
-get(buffer<T, Extent, MaxStaticBufferExtent> const& buffer) noexcept
+get(buffer<T, Extent, MaxStaticBufferExtent, A, Alignment> const& buffer) noexcept
 {
     static_assert(I < Extent, "index out of range");
     return buffer[I];
 }
 
     // Implement tuple-like protocol for `fixed_buffer<>`.
-template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent>
+template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment>
 [[nodiscard]] constexpr std::enable_if_t<Extent != dynamic_extent, T&>
-get(fixed_buffer<T, Extent, MaxBufferExtent>& buffer) noexcept
+get(fixed_buffer<T, Extent, MaxBufferExtent, Alignment>& buffer) noexcept
 {
     static_assert(I < Extent, "index out of range");
     return buffer[I];
 }
-template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent>
+template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment>
 [[nodiscard]] constexpr std::enable_if_t<Extent != dynamic_extent, T const&>
-get(fixed_buffer<T, Extent, MaxBufferExtent> const& buffer) noexcept
+get(fixed_buffer<T, Extent, MaxBufferExtent, Alignment> const& buffer) noexcept
 {
     static_assert(I < Extent, "index out of range");
     return buffer[I];
@@ -252,14 +668,14 @@ get(fixed_buffer<T, Extent, MaxBufferExtent> const& buffer) noexcept
 
 
     // Implement tuple-like protocol for `buffer<>`.
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent> class std::tuple_size<makeshift::buffer<T, Extent, MaxStaticBufferExtent>> : public std::integral_constant<std::size_t, Extent> { };
-template <typename T, std::ptrdiff_t MaxStaticBufferExtent> class std::tuple_size<makeshift::buffer<T, -1, MaxStaticBufferExtent>>; // undefined
-template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent> class std::tuple_element<I, makeshift::buffer<T, Extent, MaxStaticBufferExtent>> { public: using type = T; };
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment> class std::tuple_size<makeshift::buffer<T, Extent, MaxStaticBufferExtent, A, Alignment>> : public std::integral_constant<std::size_t, Extent> { };
+template <typename T, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment> class std::tuple_size<makeshift::buffer<T, -1, MaxStaticBufferExtent, A, Alignment>>; // undefined
+template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment> class std::tuple_element<I, makeshift::buffer<T, Extent, MaxStaticBufferExtent, A, Alignment>> { public: using type = T; };
 
     // Implement tuple-like protocol for `fixed_buffer<>`.
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent> class std::tuple_size<makeshift::fixed_buffer<T, Extent, MaxBufferExtent>> : public std::integral_constant<std::size_t, Extent> { };
-template <typename T, std::ptrdiff_t MaxBufferExtent> class std::tuple_size<makeshift::fixed_buffer<T, -1, MaxBufferExtent>>; // undefined
-template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent> class std::tuple_element<I, makeshift::fixed_buffer<T, Extent, MaxBufferExtent>> { public: using type = T; };
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment> class std::tuple_size<makeshift::fixed_buffer<T, Extent, MaxBufferExtent, Alignment>> : public std::integral_constant<std::size_t, Extent> { };
+template <typename T, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment> class std::tuple_size<makeshift::fixed_buffer<T, -1, MaxBufferExtent, Alignment>>; // undefined
+template <std::size_t I, typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxBufferExtent, std::size_t Alignment> class std::tuple_element<I, makeshift::fixed_buffer<T, Extent, MaxBufferExtent, Alignment>> { public: using type = T; };
 
 
 #endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_BUFFER_HPP_
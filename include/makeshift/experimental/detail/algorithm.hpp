@@ -0,0 +1,214 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_ALGORITHM_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_ALGORITHM_HPP_
+
+
+#include <array>
+#include <tuple>        // for tuple_size<>
+#include <vector>
+#include <cstddef>      // for size_t, byte
+#include <utility>      // for swap(), move(), index_sequence<>
+#include <type_traits>  // for remove_const<>, remove_reference<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for dim, index
+
+#include <makeshift/tuple.hpp>  // for template_for()
+
+#include <makeshift/experimental/detail/functional.hpp>  // for members_sort_key_size<>(), write_sort_key()
+
+
+namespace makeshift {
+
+namespace gsl = ::gsl_lite;
+
+namespace detail {
+
+
+template <typename ReflectorT, typename T, typename MembersT>
+void
+write_members_sort_key(std::byte* dst, T const& value, MembersT const& members) noexcept
+{
+    makeshift::template_for(
+        [&dst, &value](auto member)
+        {
+            dst = detail::write_sort_key<ReflectorT>(dst, value.*member);
+        },
+        members);
+}
+
+
+template <std::size_t KeySize>
+struct radix_sort_record
+{
+    std::array<std::byte, KeySize> key;
+    gsl::index index;
+};
+
+constexpr std::size_t radix_sort_num_chunks = 8;
+constexpr gsl::dim radix_sort_min_parallel_size = gsl::dim(1) << 16;
+
+using radix_histogram = std::array<std::size_t, 256>;
+
+    // Executes the passes of a radix sort on the calling thread. A chunk executor which sets `is_concurrent` instead provides a
+    // static function `run(func, chunkIndices)` which calls `func(c)` concurrently for all chunk indices c.
+struct sequential_chunk_executor
+{
+    static constexpr bool is_concurrent = false;
+};
+
+    // Computes the permutation which sorts the keys written by `writeKey(dst, i)` for i ∈ [0, n) with an LSD radix sort. Equal
+    // keys retain their relative order. If `ChunkExecutorT::is_concurrent` is true, the keys of every pass are distributed in
+    // chunks which are processed concurrently.
+template <typename ChunkExecutorT, std::size_t KeySize, typename WriteKeyF>
+std::vector<gsl::index>
+radix_sort_permutation(gsl::dim n, WriteKeyF&& writeKey)
+{
+    using Record = radix_sort_record<KeySize>;
+
+    std::size_t numChunks = ChunkExecutorT::is_concurrent && n >= radix_sort_min_parallel_size ? radix_sort_num_chunks : 1;
+    auto chunkBegin = [n, numChunks](std::size_t c)
+    {
+        return gsl::index(std::size_t(n)*c/numChunks);
+    };
+    auto forEachChunk = [numChunks](auto&& func)
+    {
+        if constexpr (ChunkExecutorT::is_concurrent)
+        {
+            if (numChunks > 1)
+            {
+                auto chunkIndices = std::array<std::size_t, radix_sort_num_chunks>{ };
+                for (std::size_t c = 0; c != radix_sort_num_chunks; ++c)
+                {
+                    chunkIndices[c] = c;
+                }
+                ChunkExecutorT::run(func, chunkIndices);
+                return;
+            }
+        }
+        func(std::size_t(0));
+    };
+
+    auto records = std::vector<Record>(std::size_t(n));
+    auto buffer = std::vector<Record>(std::size_t(n));
+
+        // Extract keys and compute the histograms of all key bytes in a single pass.
+    auto chunkHistograms = std::vector<std::array<radix_histogram, KeySize>>(numChunks);
+    forEachChunk(
+        [&](std::size_t c)
+        {
+            auto& histograms = chunkHistograms[c];
+            for (gsl::index i = chunkBegin(c), last = chunkBegin(c + 1); i != last; ++i)
+            {
+                Record& record = records[i];
+                writeKey(record.key.data(), i);
+                record.index = i;
+                for (std::size_t b = 0; b != KeySize; ++b)
+                {
+                    ++histograms[b][std::size_t(record.key[b])];
+                }
+            }
+        });
+
+    auto offsets = std::vector<radix_histogram>(numChunks);
+    bool isPermuted = false;
+    for (std::size_t b = KeySize; b-- != 0; )
+    {
+            // Chunk histograms are invalidated by a permuting pass and must then be recomputed.
+        if (isPermuted && numChunks > 1)
+        {
+            forEachChunk(
+                [&](std::size_t c)
+                {
+                    auto& histogram = chunkHistograms[c][b];
+                    histogram = { };
+                    for (gsl::index i = chunkBegin(c), last = chunkBegin(c + 1); i != last; ++i)
+                    {
+                        ++histogram[std::size_t(records[i].key[b])];
+                    }
+                });
+        }
+
+            // Compute the scatter offsets for every chunk, and skip the pass if all keys have the same byte value.
+        bool isTrivial = false;
+        std::size_t total = 0;
+        for (std::size_t v = 0; v != 256; ++v)
+        {
+            std::size_t count = 0;
+            for (std::size_t c = 0; c != numChunks; ++c)
+            {
+                offsets[c][v] = total + count;
+                count += chunkHistograms[c][b][v];
+            }
+            isTrivial |= count == std::size_t(n);
+            total += count;
+        }
+        if (isTrivial) continue;
+
+        forEachChunk(
+            [&](std::size_t c)
+            {
+                auto& offset = offsets[c];
+                for (gsl::index i = chunkBegin(c), last = chunkBegin(c + 1); i != last; ++i)
+                {
+                    Record const& record = records[i];
+                    buffer[offset[std::size_t(record.key[b])]++] = record;
+                }
+            });
+        std::swap(records, buffer);
+        isPermuted = true;
+    }
+
+    auto result = std::vector<gsl::index>(std::size_t(n));
+    for (gsl::index i = 0; i != n; ++i)
+    {
+        result[i] = records[i].index;
+    }
+    return result;
+}
+
+template <typename ChunkExecutorT, typename ReflectorT, typename RandomIt, typename MembersC>
+std::vector<gsl::index>
+sort_permutation_by_members(RandomIt first, RandomIt last, MembersC membersC)
+{
+    using T = std::remove_const_t<std::remove_reference_t<decltype(*first)>>;
+    constexpr auto members = membersC();
+    constexpr std::size_t keySize = detail::members_sort_key_size<T, ReflectorT>(members, std::make_index_sequence<std::tuple_size<decltype(members)>::value>{ });
+    static_assert(keySize != 0, "no members to sort by");
+
+    gsl::dim n = last - first;
+    return detail::radix_sort_permutation<ChunkExecutorT, keySize>(n,
+        [first, &members](std::byte* dst, gsl::index i)
+        {
+            detail::write_members_sort_key<ReflectorT>(dst, static_cast<T const&>(first[i]), members);
+        });
+}
+
+
+    // Permutes the records in [first, last) by moving them to a buffer in sorted order and back. Unlike the in-place cycle
+    // traversal of `apply_permutation()`, this reads the records in permutation order but writes them sequentially.
+template <typename RandomIt>
+void
+gather_permutation(RandomIt first, RandomIt last, std::vector<gsl::index> const& permutation)
+{
+    using T = std::remove_const_t<std::remove_reference_t<decltype(*first)>>;
+
+    gsl::dim n = last - first;
+    auto sorted = std::vector<T>{ };
+    sorted.reserve(std::size_t(n));
+    for (gsl::index i : permutation)
+    {
+        sorted.push_back(std::move(first[i]));
+    }
+    for (gsl::index i = 0; i != n; ++i)
+    {
+        first[i] = std::move(sorted[i]);
+    }
+}
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_ALGORITHM_HPP_
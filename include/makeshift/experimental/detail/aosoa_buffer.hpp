@@ -0,0 +1,255 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_AOSOA_BUFFER_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_AOSOA_BUFFER_HPP_
+
+
+#include <array>
+#include <tuple>
+#include <cstddef>      // for size_t, ptrdiff_t, byte
+#include <utility>      // for index_sequence<>
+#include <iterator>     // for input_iterator_tag, random_access_iterator_tag
+#include <algorithm>    // for max()
+#include <type_traits>  // for conditional<>, enable_if<>, remove_cv<>, is_const<>, is_same<>, conjunction<>, negation<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for span<>
+
+#include <makeshift/type_traits.hpp>  // for nth_type<>
+
+#include <makeshift/experimental/span.hpp>  // for soa_span<>
+
+#include <makeshift/experimental/detail/span.hpp>  // for soa_reference<>
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+    // Within a tile, the elements of every type `Ts...` are stored contiguously, one column after another. Every column starts
+    // at an offset aligned to `Alignment` or to the alignment of its element type, whichever is larger; the size of a tile is
+    // padded to a multiple of the largest column alignment, so the columns of all tiles are equally aligned.
+template <std::size_t Tile, std::size_t Alignment, typename... Ts>
+struct aosoa_layout
+{
+    static constexpr std::size_t alignment = std::max({ Alignment, alignof(Ts)... });
+
+    static constexpr std::array<std::size_t, sizeof...(Ts) + 1>
+    _compute_offsets(void) noexcept
+    {
+        constexpr std::size_t sizes[] = { Tile*sizeof(Ts)... };
+        constexpr std::size_t alignments[] = { std::max(Alignment, alignof(Ts))... };
+        auto result = std::array<std::size_t, sizeof...(Ts) + 1>{ };
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i != sizeof...(Ts); ++i)
+        {
+            offset = (offset + alignments[i] - 1)/alignments[i]*alignments[i];
+            result[i] = offset;
+            offset += sizes[i];
+        }
+        result[sizeof...(Ts)] = (offset + alignment - 1)/alignment*alignment;
+        return result;
+    }
+
+        // `offsets[I]` is the offset of column `I` in a tile; `offsets[sizeof...(Ts)]` is the distance between two tiles in bytes.
+    static constexpr std::array<std::size_t, sizeof...(Ts) + 1> offsets = _compute_offsets();
+    static constexpr std::size_t tile_stride = offsets[sizeof...(Ts)];
+
+    static constexpr std::size_t block_alignment = alignment;
+
+    template <std::size_t I>
+    [[nodiscard]] static nth_type_t<I, Ts...>*
+    column(std::byte* block, std::size_t tile) noexcept
+    {
+        return reinterpret_cast<nth_type_t<I, Ts...>*>(block + tile*tile_stride + offsets[I]);
+    }
+    template <std::size_t I>
+    [[nodiscard]] static nth_type_t<I, Ts...>*
+    element(std::byte* block, std::size_t index) noexcept
+    {
+        return column<I>(block, index/Tile) + index%Tile;
+    }
+    template <std::size_t... Is>
+    [[nodiscard]] static std::tuple<Ts*...>
+    elements(std::byte* block, std::size_t index, std::index_sequence<Is...>) noexcept
+    {
+        return { element<Is>(block, index)... };
+    }
+    template <std::size_t... Is>
+    [[nodiscard]] static std::tuple<Ts*...>
+    columns(std::byte* block, std::size_t tile, std::index_sequence<Is...>) noexcept
+    {
+        return { column<Is>(block, tile)... };
+    }
+};
+
+
+    // Random-access iterator over the elements (if `IterateTiles` is false) or over the tiles (if `IterateTiles` is true) of an
+    // `aosoa_buffer<>`. Elements are represented by `soa_reference<>` proxies, tiles by `soa_span<>` objects.
+template <bool IterateTiles, std::size_t Tile, std::size_t Alignment, typename... Ts>
+class aosoa_iterator
+{
+    template <bool RIterateTiles, std::size_t RTile, std::size_t RAlignment, typename... RTs> friend class aosoa_iterator;
+
+private:
+    using layout_ = aosoa_layout<Tile, Alignment, std::remove_cv_t<Ts>...>;
+
+    std::byte* block_;
+    std::ptrdiff_t index_;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::conditional_t<IterateTiles, soa_span<Ts...>, std::tuple<std::remove_cv_t<Ts>...>>;
+    using pointer = void;
+    using reference = std::conditional_t<IterateTiles, soa_span<Ts...>, soa_reference<Ts...>>;
+    using iterator_category = std::input_iterator_tag;  // Unfortunately we cannot be a legacy random-access iterator because of the proxy class.
+    using iterator_concept = std::random_access_iterator_tag;
+
+    constexpr aosoa_iterator(std::byte* _block, std::ptrdiff_t _index) noexcept
+        : block_(_block), index_(_index)
+    {
+    }
+    template <typename... RTs,
+              std::enable_if_t<std::conjunction_v<std::is_const<Ts>..., std::negation<std::is_const<RTs>>..., std::is_same<Ts, const RTs>...>, int> = 0>
+    constexpr aosoa_iterator(aosoa_iterator<IterateTiles, Tile, Alignment, RTs...> const& rhs) noexcept
+        : block_(rhs.block_), index_(rhs.index_)
+    {
+    }
+
+    [[nodiscard]] reference operator *(void) const noexcept
+    {
+        return (*this)[0];
+    }
+    [[nodiscard]] reference operator [](difference_type n) const noexcept
+    {
+        if constexpr (IterateTiles)
+        {
+            return std::apply(
+                [](auto*... columns)
+                {
+                    return soa_span<Ts...>(gsl::span<Ts>(columns, Tile)...);
+                },
+                layout_::columns(block_, std::size_t(index_ + n), std::index_sequence_for<Ts...>{ }));
+        }
+        else
+        {
+            return reference(layout_::elements(block_, std::size_t(index_ + n), std::index_sequence_for<Ts...>{ }));
+        }
+    }
+    constexpr aosoa_iterator& operator ++(void) noexcept
+    {
+        ++index_;
+        return *this;
+    }
+    constexpr aosoa_iterator operator ++(int) noexcept
+    {
+        auto result = *this;
+        ++index_;
+        return result;
+    }
+    constexpr aosoa_iterator& operator +=(difference_type n) noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+    constexpr aosoa_iterator& operator --(void) noexcept
+    {
+        --index_;
+        return *this;
+    }
+    constexpr aosoa_iterator operator --(int) noexcept
+    {
+        auto result = *this;
+        --index_;
+        return result;
+    }
+    constexpr aosoa_iterator& operator -=(difference_type n) noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+    [[nodiscard]] friend constexpr aosoa_iterator operator +(aosoa_iterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr aosoa_iterator operator +(difference_type n, aosoa_iterator it) noexcept
+    {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr aosoa_iterator operator -(aosoa_iterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+    [[nodiscard]] friend constexpr difference_type operator -(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return lhs.index_ - rhs.index_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator ==(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return lhs.index_ == rhs.index_;
+    }
+    [[nodiscard]] friend constexpr bool operator !=(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    [[nodiscard]] friend constexpr bool operator <(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return lhs.index_ < rhs.index_;
+    }
+    [[nodiscard]] friend constexpr bool operator >(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+    [[nodiscard]] friend constexpr bool operator <=(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+    [[nodiscard]] friend constexpr bool operator >=(aosoa_iterator const& lhs, aosoa_iterator const& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+};
+
+
+    // Range of the tiles of an `aosoa_buffer<>`.
+template <std::size_t Tile, std::size_t Alignment, typename... Ts>
+class aosoa_tile_range
+{
+private:
+    std::byte* block_;
+    std::size_t numTiles_;
+
+public:
+    using iterator = aosoa_iterator<true, Tile, Alignment, Ts...>;
+
+    constexpr aosoa_tile_range(std::byte* _block, std::size_t _numTiles) noexcept
+        : block_(_block), numTiles_(_numTiles)
+    {
+    }
+
+    [[nodiscard]] constexpr iterator begin(void) const noexcept
+    {
+        return { block_, 0 };
+    }
+    [[nodiscard]] constexpr iterator end(void) const noexcept
+    {
+        return { block_, std::ptrdiff_t(numTiles_) };
+    }
+    [[nodiscard]] constexpr std::size_t size(void) const noexcept
+    {
+        return numTiles_;
+    }
+    [[nodiscard]] constexpr bool empty(void) const noexcept
+    {
+        return numTiles_ == 0;
+    }
+};
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_AOSOA_BUFFER_HPP_
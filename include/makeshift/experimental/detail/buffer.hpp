@@ -4,11 +4,15 @@
 
 
 #include <array>
-#include <cstddef>      // for size_t, ptrdiff_t
-#include <algorithm>    // for copy()
-#include <type_traits>  // for integral_constant<>
+#include <memory>       // for allocator<>, allocator_traits<>, uninitialized_copy_n()
+#include <cstddef>      // for size_t, ptrdiff_t, byte
+#include <numeric>      // for gcd()
+#include <utility>      // for move()
+#include <iterator>     // for make_move_iterator(), input_iterator_tag, random_access_iterator_tag
+#include <algorithm>    // for copy(), move(), fill()
+#include <type_traits>  // for integral_constant<>, is_empty<>, is_final<>, is_trivially_default_constructible<>, is_trivially_copyable<>, is_nothrow_move_assignable<>, is_same<>
 
-#include <gsl-lite/gsl-lite.hpp> // for gsl_Expects(), gsl_constexpr17
+#include <gsl-lite/gsl-lite.hpp> // for span<>, gsl_Expects(), gsl_constexpr17
 
 
 namespace makeshift {
@@ -20,6 +24,9 @@ namespace gsl = ::gsl_lite;
 namespace detail {
 
 
+struct default_init_t { };
+
+
 template <typename T, typename DerivedT>
 class buffer_interface_mixin
 {
@@ -94,21 +101,64 @@ public:
     }
 };
 
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxExtent = -1>
-class static_buffer_base : public buffer_interface_mixin<T, static_buffer_base<T, Extent, MaxExtent>>
+template <typename T, std::size_t Alignment>
+constexpr void
+check_buffer_alignment(void) noexcept
+{
+    static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of 2");
+    static_assert(Alignment >= alignof(T), "alignment must not be smaller than the alignment of the element type");
+}
+
+    // If the buffer alignment exceeds the alignment of the element type, the storage is padded such that its size in bytes is a
+    // multiple of the alignment.
+template <typename T, std::size_t Alignment>
+[[nodiscard]] constexpr std::size_t
+padded_buffer_size(std::size_t size) noexcept
+{
+    if constexpr (Alignment <= alignof(T))
+    {
+        return size;
+    }
+    else
+    {
+        constexpr std::size_t granularity = Alignment/std::gcd(Alignment, sizeof(T));
+        return (size + granularity - 1)/granularity*granularity;
+    }
+}
+template <typename T, std::ptrdiff_t Extent, std::size_t Alignment>
+constexpr std::size_t padded_buffer_extent = detail::padded_buffer_size<T, Alignment>(std::size_t(Extent));
+
+template <typename T, std::size_t Alignment>
+void
+value_initialize_padding(T* data, std::size_t size)
+{
+    if constexpr (std::is_trivially_default_constructible<T>::value)
+    {
+        std::fill(data + size, data + detail::padded_buffer_size<T, Alignment>(size), T{ });
+    }
+}
+
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxExtent = -1, std::size_t Alignment = alignof(T)>
+class static_buffer_base : public buffer_interface_mixin<T, static_buffer_base<T, Extent, MaxExtent, Alignment>>
 {
     static_assert(Extent >= 0, "buffer extent must be non-negative");
 
 private:
-    std::array<T, Extent> data_;
+    alignas(Alignment) std::array<T, padded_buffer_extent<T, Extent, Alignment>> data_;
 
 public:
-    using iterator = typename std::array<T, Extent>::iterator;
-    using const_iterator = typename std::array<T, Extent>::const_iterator;
+    using iterator = typename std::array<T, padded_buffer_extent<T, Extent, Alignment>>::iterator;
+    using const_iterator = typename std::array<T, padded_buffer_extent<T, Extent, Alignment>>::const_iterator;
 
     constexpr static_buffer_base(std::size_t)
         : data_{ }
     {
+        detail::check_buffer_alignment<T, Alignment>();
+    }
+    static_buffer_base(std::size_t, default_init_t)
+    {
+        detail::check_buffer_alignment<T, Alignment>();
+        detail::value_initialize_padding<T, Alignment>(data_.data(), Extent);
     }
 
     [[nodiscard]] gsl_constexpr17 iterator begin(void) noexcept
@@ -121,17 +171,21 @@ public:
     }
     [[nodiscard]] gsl_constexpr17 iterator end(void) noexcept
     {
-        return data_.end();
+        return data_.begin() + Extent;
     }
     [[nodiscard]] gsl_constexpr17 const_iterator end(void) const noexcept
     {
-        return data_.end();
+        return data_.begin() + Extent;
     }
 
     [[nodiscard]] constexpr std::size_t size(void) const noexcept
     {
         return Extent;
     }
+    [[nodiscard]] constexpr std::size_t padded_size(void) const noexcept
+    {
+        return padded_buffer_extent<T, Extent, Alignment>;
+    }
 
     [[nodiscard]] gsl_constexpr17 T* data(void) noexcept
     {
@@ -142,23 +196,34 @@ public:
         return data_.data();
     }
 };
-template <typename T, std::ptrdiff_t MaxExtent>
-class static_buffer_base<T, -1, MaxExtent> : public buffer_interface_mixin<T, static_buffer_base<T, -1, MaxExtent>>
+template <typename T, std::ptrdiff_t MaxExtent, std::size_t Alignment>
+class static_buffer_base<T, -1, MaxExtent, Alignment> : public buffer_interface_mixin<T, static_buffer_base<T, -1, MaxExtent, Alignment>>
 {
 private:
-    std::array<T, MaxExtent> data_;
+    alignas(Alignment) std::array<T, padded_buffer_extent<T, MaxExtent, Alignment>> data_;
     std::size_t size_;
 
 public:
     constexpr static_buffer_base(std::size_t _size)
         : data_{ }, size_(_size)
     {
+        detail::check_buffer_alignment<T, Alignment>();
+    }
+    static_buffer_base(std::size_t _size, default_init_t)
+        : size_(_size)
+    {
+        detail::check_buffer_alignment<T, Alignment>();
+        detail::value_initialize_padding<T, Alignment>(data_.data(), _size);
     }
 
     [[nodiscard]] constexpr std::size_t size(void) const noexcept
     {
         return size_;
     }
+    [[nodiscard]] constexpr std::size_t padded_size(void) const noexcept
+    {
+        return detail::padded_buffer_size<T, Alignment>(size_);
+    }
 
     [[nodiscard]] gsl_constexpr17 T* data(void) noexcept
     {
@@ -170,99 +235,470 @@ public:
     }
 };
 
-template <typename T, std::ptrdiff_t BufExtent>
-class dynamic_buffer_base : public buffer_interface_mixin<T, dynamic_buffer_base<T, BufExtent>>
+    // Holds an allocator; empty allocators do not take up any space.
+template <typename A, bool EBO = std::is_empty<A>::value && !std::is_final<A>::value>
+class allocator_holder : private A
+{
+public:
+    constexpr allocator_holder(A const& alloc) noexcept
+        : A(alloc)
+    {
+    }
+
+    [[nodiscard]] constexpr A& allocator(void) noexcept
+    {
+        return *this;
+    }
+    [[nodiscard]] constexpr A const& allocator(void) const noexcept
+    {
+        return *this;
+    }
+};
+template <typename A>
+class allocator_holder<A, false>
 {
 private:
-    T* data_;
-    std::size_t size_;
-    std::array<T, BufExtent> buf_;
+    A alloc_;
 
 public:
-    constexpr dynamic_buffer_base(std::size_t _size)
-        : size_(_size)
+    constexpr allocator_holder(A const& alloc) noexcept
+        : alloc_(alloc)
+    {
+    }
+
+    [[nodiscard]] constexpr A& allocator(void) noexcept
+    {
+        return alloc_;
+    }
+    [[nodiscard]] constexpr A const& allocator(void) const noexcept
+    {
+        return alloc_;
+    }
+};
+
+template <typename T, typename A>
+struct dynamic_buffer_storage : allocator_holder<A>
+{
+    static_assert(std::is_same<typename std::allocator_traits<A>::value_type, T>::value, "allocator value type must match buffer element type");
+    static_assert(std::is_same<typename std::allocator_traits<A>::pointer, T*>::value, "allocators with fancy pointers are not supported");
+
+    T* data;
+    std::size_t size;
+
+    constexpr dynamic_buffer_storage(A const& alloc, std::size_t _size) noexcept
+        : allocator_holder<A>(alloc), data(nullptr), size(_size)
+    {
+    }
+};
+
+template <std::size_t Alignment>
+struct alignas(Alignment) aligned_block
+{
+    std::byte bytes[Alignment];
+};
+
+    // Over-aligned storage is allocated as an array of aligned blocks with an allocator rebound to the block type.
+template <typename T, std::size_t Alignment, typename A>
+T*
+allocate_storage(A& alloc, std::size_t capacity)
+{
+    if constexpr (Alignment <= alignof(T))
+    {
+        return std::allocator_traits<A>::allocate(alloc, capacity);
+    }
+    else
+    {
+        using BlockAlloc = typename std::allocator_traits<A>::template rebind_alloc<aligned_block<Alignment>>;
+        auto blockAlloc = BlockAlloc(alloc);
+        return reinterpret_cast<T*>(std::allocator_traits<BlockAlloc>::allocate(blockAlloc, capacity*sizeof(T)/Alignment));
+    }
+}
+template <typename T, std::size_t Alignment, typename A>
+void
+deallocate_storage(A& alloc, T* data, std::size_t capacity) noexcept
+{
+    if constexpr (Alignment <= alignof(T))
+    {
+        std::allocator_traits<A>::deallocate(alloc, data, capacity);
+    }
+    else
+    {
+        using BlockAlloc = typename std::allocator_traits<A>::template rebind_alloc<aligned_block<Alignment>>;
+        auto blockAlloc = BlockAlloc(alloc);
+        std::allocator_traits<BlockAlloc>::deallocate(blockAlloc, reinterpret_cast<aligned_block<Alignment>*>(data), capacity*sizeof(T)/Alignment);
+    }
+}
+
+template <typename T, std::size_t Alignment, typename A>
+void
+destroy_and_deallocate(A& alloc, T* data, std::size_t capacity, std::size_t numConstructed) noexcept
+{
+    using Traits = std::allocator_traits<A>;
+
+    for (std::size_t i = numConstructed; i != 0; --i)
+    {
+        Traits::destroy(alloc, data + (i - 1));
+    }
+    detail::deallocate_storage<T, Alignment>(alloc, data, capacity);
+}
+
+    // Value-initializes the elements in the range [first, capacity). Destroys all elements and deallocates the storage on failure.
+template <typename T, std::size_t Alignment, typename A>
+void
+value_initialize_elements(A& alloc, T* data, std::size_t first, std::size_t capacity)
+{
+    using Traits = std::allocator_traits<A>;
+
+    std::size_t i = first;
+    try
+    {
+        for (; i != capacity; ++i)
+        {
+            Traits::construct(alloc, data + i);
+        }
+    }
+    catch (...)
+    {
+        detail::destroy_and_deallocate<T, Alignment>(alloc, data, capacity, i);
+        throw;
+    }
+}
+
+template <typename T, std::size_t Alignment, typename A>
+T*
+allocate_value_initialized(A& alloc, std::size_t capacity)
+{
+    T* data = detail::allocate_storage<T, Alignment>(alloc, capacity);
+    detail::value_initialize_elements<T, Alignment>(alloc, data, 0, capacity);
+    return data;
+}
+
+    // Leaves elements of trivially default-constructible types uninitialized, except for the padding.
+template <typename T, std::size_t Alignment, typename A>
+T*
+allocate_default_initialized(A& alloc, std::size_t size, std::size_t capacity)
+{
+    if constexpr (std::is_trivially_default_constructible<T>::value)
+    {
+        T* data = detail::allocate_storage<T, Alignment>(alloc, capacity);
+        detail::value_initialize_elements<T, Alignment>(alloc, data, size, capacity);
+        return data;
+    }
+    else
+    {
+        return detail::allocate_value_initialized<T, Alignment>(alloc, capacity);
+    }
+}
+
+template <typename T, std::size_t Alignment, typename A, typename It>
+T*
+allocate_copy(A& alloc, It first, std::size_t capacity)
+{
+    using Traits = std::allocator_traits<A>;
+
+    T* data = detail::allocate_storage<T, Alignment>(alloc, capacity);
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        std::uninitialized_copy_n(first, capacity, data);
+    }
+    else
+    {
+        std::size_t i = 0;
+        try
+        {
+            for (; i != capacity; ++i, ++first)
+            {
+                Traits::construct(alloc, data + i, *first);
+            }
+        }
+        catch (...)
+        {
+            detail::destroy_and_deallocate<T, Alignment>(alloc, data, capacity, i);
+            throw;
+        }
+    }
+    return data;
+}
+
+template <typename T, std::ptrdiff_t BufExtent, typename A = std::allocator<T>, std::size_t Alignment = alignof(T)>
+class dynamic_buffer_base : public buffer_interface_mixin<T, dynamic_buffer_base<T, BufExtent, A, Alignment>>
+{
+private:
+    using Traits_ = std::allocator_traits<A>;
+
+    dynamic_buffer_storage<T, A> storage_;
+    alignas(Alignment) std::array<T, padded_buffer_extent<T, BufExtent, Alignment>> buf_;
+
+    [[nodiscard]] bool _on_heap(void) const noexcept
+    {
+        return storage_.data != buf_.data();
+    }
+    void _release(void) noexcept
+    {
+        if (_on_heap())
+            detail::destroy_and_deallocate<T, Alignment>(storage_.allocator(), storage_.data, padded_size(), padded_size());
+        storage_.data = buf_.data();
+        storage_.size = 0;
+    }
+
+        // Takes over the elements of `rhs`, stealing its heap storage or moving its in-place elements. The heap storage of `rhs`
+        // must be deallocatable with our allocator.
+    void _take(dynamic_buffer_base& rhs) noexcept(std::is_nothrow_move_assignable<T>::value)
+    {
+        if (rhs._on_heap())
+        {
+            storage_.data = rhs.storage_.data;
+            rhs.storage_.data = rhs.buf_.data();
+        }
+        else
+        {
+            std::move(rhs.buf_.begin(), rhs.buf_.begin() + rhs.padded_size(), buf_.begin());
+        }
+        storage_.size = rhs.storage_.size;
+        rhs.storage_.size = 0;
+    }
+
+        // Moves the elements of `rhs` to storage obtained from our allocator.
+    void _move_elements(dynamic_buffer_base& rhs)
+    {
+        if (rhs._on_heap())
+        {
+            storage_.data = detail::allocate_copy<T, Alignment>(storage_.allocator(), std::make_move_iterator(rhs.storage_.data), rhs.padded_size());
+            storage_.size = rhs.storage_.size;
+        }
+        else
+        {
+            _take(rhs);
+        }
+    }
+
+public:
+    constexpr dynamic_buffer_base(std::size_t _size, A const& alloc = A())
+        : storage_(alloc, _size), buf_{ }
+    {
+        detail::check_buffer_alignment<T, Alignment>();
+        if (_size <= BufExtent)
+            storage_.data = buf_.data();
+        else
+            storage_.data = detail::allocate_value_initialized<T, Alignment>(storage_.allocator(), padded_size());
+    }
+    dynamic_buffer_base(std::size_t _size, default_init_t, A const& alloc = A())
+        : storage_(alloc, _size)
     {
+        detail::check_buffer_alignment<T, Alignment>();
         if (_size <= BufExtent)
-            data_ = buf_.data();
+        {
+            storage_.data = buf_.data();
+            detail::value_initialize_padding<T, Alignment>(storage_.data, _size);
+        }
         else
-            data_ = new T[_size]{ };
+            storage_.data = detail::allocate_default_initialized<T, Alignment>(storage_.allocator(), _size, padded_size());
     }
-    constexpr dynamic_buffer_base(dynamic_buffer_base const& rhs)
-        : dynamic_buffer_base(rhs.size_)
+    dynamic_buffer_base(dynamic_buffer_base const& rhs, A const& alloc)
+        : storage_(alloc, rhs.size())
     {
-        // TODO: we could use non-initializing allocation and unitialized_copy() to optimize this further
-        std::copy(rhs.begin(), rhs.end(), data_);
+        if (storage_.size <= BufExtent)
+        {
+            storage_.data = buf_.data();
+            std::copy(rhs.data(), rhs.data() + rhs.padded_size(), storage_.data);
+        }
+        else
+            storage_.data = detail::allocate_copy<T, Alignment>(storage_.allocator(), rhs.data(), rhs.padded_size());
     }
-    constexpr dynamic_buffer_base& operator =(dynamic_buffer_base const& rhs)
+    dynamic_buffer_base(dynamic_buffer_base const& rhs)
+        : dynamic_buffer_base(rhs, Traits_::select_on_container_copy_construction(rhs.get_allocator()))
     {
-        *this = dynamic_buffer_base(rhs); // copy & move for exception safety
+    }
+    dynamic_buffer_base(dynamic_buffer_base&& rhs) noexcept(std::is_nothrow_move_assignable<T>::value)
+        : storage_(rhs.storage_.allocator(), 0)
+    {
+        storage_.data = buf_.data();
+        _take(rhs);
+    }
+    dynamic_buffer_base& operator =(dynamic_buffer_base const& rhs)
+    {
+        if (this != &rhs)
+        {
+                // Copy first for exception safety.
+            auto copy = dynamic_buffer_base(rhs, Traits_::propagate_on_container_copy_assignment::value ? rhs.storage_.allocator() : storage_.allocator());
+            _release();
+            if constexpr (Traits_::propagate_on_container_copy_assignment::value)
+                storage_.allocator() = rhs.storage_.allocator();
+            _take(copy);
+        }
+        return *this;
+    }
+    dynamic_buffer_base& operator =(dynamic_buffer_base&& rhs)
+        noexcept((Traits_::propagate_on_container_move_assignment::value || Traits_::is_always_equal::value) && std::is_nothrow_move_assignable<T>::value)
+    {
+        if (this != &rhs)
+        {
+            _release();
+            if constexpr (Traits_::propagate_on_container_move_assignment::value)
+            {
+                storage_.allocator() = std::move(rhs.storage_.allocator());
+                _take(rhs);
+            }
+            else if (storage_.allocator() == rhs.storage_.allocator())
+                _take(rhs);
+            else
+                _move_elements(rhs);
+        }
         return *this;
     }
-    dynamic_buffer_base(dynamic_buffer_base&& rhs) noexcept = delete;
-    dynamic_buffer_base& operator =(dynamic_buffer_base&& rhs) noexcept = delete;
     ~dynamic_buffer_base(void)
     {
-        if (data_ != buf_.data())
-            delete[] data_;
+        if (_on_heap())
+            detail::destroy_and_deallocate<T, Alignment>(storage_.allocator(), storage_.data, padded_size(), padded_size());
+    }
+
+    [[nodiscard]] constexpr A get_allocator(void) const noexcept
+    {
+        return storage_.allocator();
     }
 
     [[nodiscard]] constexpr std::size_t size(void) const noexcept
     {
-        return size_;
+        return storage_.size;
+    }
+    [[nodiscard]] constexpr std::size_t padded_size(void) const noexcept
+    {
+        return detail::padded_buffer_size<T, Alignment>(storage_.size);
     }
 
     [[nodiscard]] constexpr T* data(void) noexcept
     {
-        return data_;
+        return storage_.data;
     }
     [[nodiscard]] constexpr T const* data(void) const noexcept
     {
-        return data_;
+        return storage_.data;
     }
 };
 
-template <typename T>
-class dynamic_buffer_base<T, 0> : public buffer_interface_mixin<T, dynamic_buffer_base<T, 0>>
+template <typename T, typename A, std::size_t Alignment>
+class dynamic_buffer_base<T, 0, A, Alignment> : public buffer_interface_mixin<T, dynamic_buffer_base<T, 0, A, Alignment>>
 {
 private:
-    T* data_;
-    std::size_t size_;
+    using Traits_ = std::allocator_traits<A>;
+
+    dynamic_buffer_storage<T, A> storage_;
+
+    void _release(void) noexcept
+    {
+        if (storage_.data != nullptr)
+            detail::destroy_and_deallocate<T, Alignment>(storage_.allocator(), storage_.data, padded_size(), padded_size());
+        storage_.data = nullptr;
+        storage_.size = 0;
+    }
+
+        // Steals the heap storage of `rhs`, which must be deallocatable with our allocator.
+    void _take(dynamic_buffer_base& rhs) noexcept
+    {
+        storage_.data = rhs.storage_.data;
+        storage_.size = rhs.storage_.size;
+        rhs.storage_.data = nullptr;
+        rhs.storage_.size = 0;
+    }
+
+        // Moves the elements of `rhs` to storage obtained from our allocator.
+    void _move_elements(dynamic_buffer_base& rhs)
+    {
+        if (rhs.storage_.data != nullptr)
+        {
+            storage_.data = detail::allocate_copy<T, Alignment>(storage_.allocator(), std::make_move_iterator(rhs.storage_.data), rhs.padded_size());
+            storage_.size = rhs.storage_.size;
+        }
+    }
 
 public:
-    constexpr dynamic_buffer_base(std::size_t _size)
-        : data_(_size > 0 ? new T[_size]{ } : nullptr), size_(_size)
+    constexpr dynamic_buffer_base(std::size_t _size, A const& alloc = A())
+        : storage_(alloc, _size)
+    {
+        detail::check_buffer_alignment<T, Alignment>();
+        if (_size > 0)
+            storage_.data = detail::allocate_value_initialized<T, Alignment>(storage_.allocator(), padded_size());
+    }
+    dynamic_buffer_base(std::size_t _size, default_init_t, A const& alloc = A())
+        : storage_(alloc, _size)
+    {
+        detail::check_buffer_alignment<T, Alignment>();
+        if (_size > 0)
+            storage_.data = detail::allocate_default_initialized<T, Alignment>(storage_.allocator(), _size, padded_size());
+    }
+    dynamic_buffer_base(dynamic_buffer_base const& rhs, A const& alloc)
+        : storage_(alloc, rhs.size())
     {
+        if (storage_.size > 0)
+            storage_.data = detail::allocate_copy<T, Alignment>(storage_.allocator(), rhs.data(), rhs.padded_size());
     }
-    constexpr dynamic_buffer_base(dynamic_buffer_base const& rhs)
-        : dynamic_buffer_base(rhs.size_)
+    dynamic_buffer_base(dynamic_buffer_base const& rhs)
+        : dynamic_buffer_base(rhs, Traits_::select_on_container_copy_construction(rhs.get_allocator()))
     {
-        // TODO: we could use non-initializing allocation and unitialized_copy() to optimize this further
-        std::copy(rhs.begin(), rhs.end(), data_);
     }
-    constexpr dynamic_buffer_base& operator =(dynamic_buffer_base const& rhs)
+    dynamic_buffer_base(dynamic_buffer_base&& rhs) noexcept
+        : storage_(rhs.storage_.allocator(), 0)
     {
-        *this = dynamic_buffer_base(rhs); // copy & move for exception safety
+        _take(rhs);
+    }
+    dynamic_buffer_base& operator =(dynamic_buffer_base const& rhs)
+    {
+        if (this != &rhs)
+        {
+                // Copy first for exception safety.
+            auto copy = dynamic_buffer_base(rhs, Traits_::propagate_on_container_copy_assignment::value ? rhs.storage_.allocator() : storage_.allocator());
+            _release();
+            if constexpr (Traits_::propagate_on_container_copy_assignment::value)
+                storage_.allocator() = rhs.storage_.allocator();
+            _take(copy);
+        }
+        return *this;
+    }
+    dynamic_buffer_base& operator =(dynamic_buffer_base&& rhs)
+        noexcept(Traits_::propagate_on_container_move_assignment::value || Traits_::is_always_equal::value)
+    {
+        if (this != &rhs)
+        {
+            _release();
+            if constexpr (Traits_::propagate_on_container_move_assignment::value)
+            {
+                storage_.allocator() = std::move(rhs.storage_.allocator());
+                _take(rhs);
+            }
+            else if (storage_.allocator() == rhs.storage_.allocator())
+                _take(rhs);
+            else
+                _move_elements(rhs);
+        }
         return *this;
     }
-    dynamic_buffer_base(dynamic_buffer_base&& rhs) noexcept = delete;
-    dynamic_buffer_base& operator =(dynamic_buffer_base&& rhs) noexcept = delete;
     ~dynamic_buffer_base(void)
     {
-        delete[] data_;
+        if (storage_.data != nullptr)
+            detail::destroy_and_deallocate<T, Alignment>(storage_.allocator(), storage_.data, padded_size(), padded_size());
+    }
+
+    [[nodiscard]] constexpr A get_allocator(void) const noexcept
+    {
+        return storage_.allocator();
     }
 
     [[nodiscard]] constexpr std::size_t size(void) const noexcept
     {
-        return size_;
+        return storage_.size;
+    }
+    [[nodiscard]] constexpr std::size_t padded_size(void) const noexcept
+    {
+        return detail::padded_buffer_size<T, Alignment>(storage_.size);
     }
 
     [[nodiscard]] constexpr T* data(void) noexcept
     {
-        return data_;
+        return storage_.data;
     }
     [[nodiscard]] constexpr T const* data(void) const noexcept
     {
-        return data_;
+        return storage_.data;
     }
 };
 
@@ -284,34 +720,46 @@ static constexpr memory_location determine_memory_location(std::ptrdiff_t bufExt
 }
 
 
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, memory_location MemoryLocation>
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment, memory_location MemoryLocation>
 class buffer_base;
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent>
-class buffer_base<T, Extent, MaxStaticBufferExtent, memory_location::always_on_stack>
-    : public static_buffer_base<T, Extent>
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment>
+class buffer_base<T, Extent, MaxStaticBufferExtent, A, Alignment, memory_location::always_on_stack>
+    : public static_buffer_base<T, Extent, -1, Alignment>
 {
 private:
-    using base_ = static_buffer_base<T, Extent>;
+    using base_ = static_buffer_base<T, Extent, -1, Alignment>;
 
 public:
-    using base_::base_;
+    constexpr buffer_base(std::size_t _size, A const& /*alloc*/)
+        : base_(_size)
+    {
+    }
+    buffer_base(std::size_t _size, default_init_t, A const& /*alloc*/)
+        : base_(_size, default_init_t{ })
+    {
+    }
+
+    [[nodiscard]] constexpr A get_allocator(void) const noexcept
+    {
+        return A();
+    }
 };
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent>
-class buffer_base<T, Extent, MaxStaticBufferExtent, memory_location::dynamic>
-    : public dynamic_buffer_base<T, MaxStaticBufferExtent>
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment>
+class buffer_base<T, Extent, MaxStaticBufferExtent, A, Alignment, memory_location::dynamic>
+    : public dynamic_buffer_base<T, MaxStaticBufferExtent, A, Alignment>
 {
 private:
-    using base_ = dynamic_buffer_base<T, MaxStaticBufferExtent>;
+    using base_ = dynamic_buffer_base<T, MaxStaticBufferExtent, A, Alignment>;
 
 public:
     using base_::base_;
 };
-template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent>
-class buffer_base<T, Extent, MaxStaticBufferExtent, memory_location::never_on_stack>
-    : public dynamic_buffer_base<T, 0>
+template <typename T, std::ptrdiff_t Extent, std::ptrdiff_t MaxStaticBufferExtent, typename A, std::size_t Alignment>
+class buffer_base<T, Extent, MaxStaticBufferExtent, A, Alignment, memory_location::never_on_stack>
+    : public dynamic_buffer_base<T, 0, A, Alignment>
 {
 private:
-    using base_ = dynamic_buffer_base<T, 0>;
+    using base_ = dynamic_buffer_base<T, 0, A, Alignment>;
 
 public:
     using base_::base_;
@@ -338,6 +786,131 @@ constexpr void check_buffer_extents(std::false_type /*dynamicExtent*/, std::ptrd
 {
     gsl_Expects(actualExtent == expectedExtent);
 }
+    // Iterates over the rows of a `row_buffer<>`, which are represented as spans.
+template <typename T>
+class row_buffer_iterator
+{
+    template <typename U> friend class row_buffer_iterator;
+
+private:
+    T* data_;
+    std::ptrdiff_t index_;
+    std::ptrdiff_t leadingDimension_;
+    std::size_t cols_;
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = gsl::span<T>;
+    using pointer = void;
+    using reference = gsl::span<T>;
+    using iterator_category = std::input_iterator_tag;  // Rows are returned by value, so we cannot be a legacy random-access iterator.
+    using iterator_concept = std::random_access_iterator_tag;
+
+    constexpr row_buffer_iterator(T* _data, std::ptrdiff_t _index, std::ptrdiff_t _leadingDimension, std::size_t _cols) noexcept
+        : data_(_data), index_(_index), leadingDimension_(_leadingDimension), cols_(_cols)
+    {
+    }
+    template <typename U,
+              std::enable_if_t<std::is_same<T, U const>::value && !std::is_same<T, U>::value, int> = 0>
+    constexpr row_buffer_iterator(row_buffer_iterator<U> const& rhs) noexcept
+        : data_(rhs.data_), index_(rhs.index_), leadingDimension_(rhs.leadingDimension_), cols_(rhs.cols_)
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator *(void) const noexcept
+    {
+        return { data_ + index_*leadingDimension_, cols_ };
+    }
+    [[nodiscard]] constexpr reference operator [](difference_type n) const noexcept
+    {
+        return { data_ + (index_ + n)*leadingDimension_, cols_ };
+    }
+    constexpr row_buffer_iterator& operator ++(void) noexcept
+    {
+        ++index_;
+        return *this;
+    }
+    constexpr row_buffer_iterator operator ++(int) noexcept
+    {
+        auto result = *this;
+        ++index_;
+        return result;
+    }
+    constexpr row_buffer_iterator& operator +=(difference_type n) noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+    constexpr row_buffer_iterator& operator --(void) noexcept
+    {
+        --index_;
+        return *this;
+    }
+    constexpr row_buffer_iterator operator --(int) noexcept
+    {
+        auto result = *this;
+        --index_;
+        return result;
+    }
+    constexpr row_buffer_iterator& operator -=(difference_type n) noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+    [[nodiscard]] friend constexpr row_buffer_iterator operator +(row_buffer_iterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr row_buffer_iterator operator +(difference_type n, row_buffer_iterator it) noexcept
+    {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr row_buffer_iterator operator -(row_buffer_iterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+    [[nodiscard]] friend constexpr difference_type operator -(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return lhs.index_ - rhs.index_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator ==(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return lhs.index_ == rhs.index_;
+    }
+    [[nodiscard]] friend constexpr bool operator !=(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    [[nodiscard]] friend constexpr bool operator <(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return lhs.index_ < rhs.index_;
+    }
+    [[nodiscard]] friend constexpr bool operator >(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+    [[nodiscard]] friend constexpr bool operator <=(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+    [[nodiscard]] friend constexpr bool operator >=(row_buffer_iterator const& lhs, row_buffer_iterator const& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+};
+
+    // The leading dimension of a `row_buffer<>` is the number of columns padded such that every row starts at an address
+    // aligned to `Alignment` bytes.
+template <typename T, std::size_t Alignment>
+constexpr std::ptrdiff_t
+row_buffer_leading_dimension(std::ptrdiff_t cols) noexcept
+{
+    return cols != -1
+        ? std::ptrdiff_t(detail::padded_buffer_size<T, Alignment>(std::size_t(cols)))
+        : -1;
+}
+
 template <typename C>
 constexpr void check_fixed_buffer_extents(std::true_type /*dynamicExtent*/, std::ptrdiff_t /*expectedExtent*/, C actualExtent, std::ptrdiff_t maxBufferExtent)
 {
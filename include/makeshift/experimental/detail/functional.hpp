@@ -3,8 +3,23 @@
 #define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_FUNCTIONAL_HPP_
 
 
-#include <utility>      // for forward<>()
-#include <type_traits>  // for void_t<>
+#include <array>
+#include <tuple>        // for tuple_size<>, tuple_element<>
+#include <cstddef>      // for size_t, byte
+#include <cstdint>      // for uint32_t, uint64_t
+#include <cstring>      // for memcpy()
+#include <utility>      // for forward<>(), declval<>(), index_sequence<>
+#include <iterator>     // for begin(), end()
+#include <algorithm>    // for equal(), lexicographical_compare()
+#include <optional>
+#include <functional>   // for hash<>
+#include <string_view>
+#include <type_traits>  // for void_t<>, integral_constant<>, has_unique_object_representations<>, is_array<>, is_class<>, is_enum<>, is_floating_point<>, is_convertible<>, is_integral<>, is_signed<>, underlying_type<>, make_unsigned<>, remove_extent<>
+
+#include <makeshift/tuple.hpp>     // for template_for(), apply()
+#include <makeshift/metadata.hpp>  // for metadata::members<>(), metadata::is_available()
+
+#include <makeshift/experimental/detail/type_traits.hpp>  // for member_value_t<>, is_std_array_<>, unsigned_of_size_t<>
 
 
 namespace makeshift {
@@ -90,6 +105,387 @@ struct forward_to_impl<F, std::void_t<decltype(std::declval<F>()())>> : F
 };
 
 
+    // Self-contained hash function in the style of wyhash. It is fast for short keys and not suitable for cryptographic
+    // purposes. Results depend on the byte order of the host.
+constexpr inline std::uint64_t wyhash_secret[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+inline std::uint64_t
+wyhash_mix(std::uint64_t a, std::uint64_t b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;  // `__extension__` silences `-Wpedantic`
+    uint128 r = static_cast<uint128>(a)*b;
+    return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64);
+#else
+        // Portable 64×64→128 bit multiplication.
+    std::uint64_t ha = a >> 32, la = std::uint32_t(a), hb = b >> 32, lb = std::uint32_t(b);
+    std::uint64_t rh = ha*hb, rm0 = ha*lb, rm1 = hb*la, rl = la*lb;
+    std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t c = t < rl;
+    std::uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    std::uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+}
+
+inline std::uint64_t
+wyhash_read8(unsigned char const* p) noexcept
+{
+    std::uint64_t result;
+    std::memcpy(&result, p, 8);
+    return result;
+}
+inline std::uint64_t
+wyhash_read4(unsigned char const* p) noexcept
+{
+    std::uint32_t result;
+    std::memcpy(&result, p, 4);
+    return result;
+}
+
+inline std::uint64_t
+hash_bytes(void const* data, std::size_t size, std::uint64_t seed = 0) noexcept
+{
+    auto p = static_cast<unsigned char const*>(data);
+    seed ^= detail::wyhash_mix(seed ^ wyhash_secret[0], wyhash_secret[1]);
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            std::size_t d = (size >> 3) << 2;
+            a = (detail::wyhash_read4(p) << 32) | detail::wyhash_read4(p + d);
+            b = (detail::wyhash_read4(p + size - 4) << 32) | detail::wyhash_read4(p + size - 4 - d);
+        }
+        else if (size > 0)
+        {
+            a = (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[size >> 1]) << 8) | p[size - 1];
+        }
+    }
+    else
+    {
+        std::size_t i = size;
+        if (i > 48)
+        {
+            std::uint64_t seed1 = seed;
+            std::uint64_t seed2 = seed;
+            do
+            {
+                seed = detail::wyhash_mix(detail::wyhash_read8(p) ^ wyhash_secret[1], detail::wyhash_read8(p + 8) ^ seed);
+                seed1 = detail::wyhash_mix(detail::wyhash_read8(p + 16) ^ wyhash_secret[2], detail::wyhash_read8(p + 24) ^ seed1);
+                seed2 = detail::wyhash_mix(detail::wyhash_read8(p + 32) ^ wyhash_secret[3], detail::wyhash_read8(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16)
+        {
+            seed = detail::wyhash_mix(detail::wyhash_read8(p) ^ wyhash_secret[1], detail::wyhash_read8(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = detail::wyhash_read8(p + i - 16);
+        b = detail::wyhash_read8(p + i - 8);
+    }
+    return detail::wyhash_mix(wyhash_secret[1] ^ size, detail::wyhash_mix(a ^ wyhash_secret[1], b ^ seed));
+}
+
+inline std::uint64_t
+hash_combine(std::uint64_t seed, std::uint64_t hash) noexcept
+{
+    return detail::wyhash_mix(seed ^ wyhash_secret[0], hash ^ wyhash_secret[1]);
+}
+
+
+template <typename T> struct is_optional_ : std::false_type { };
+template <typename T> struct is_optional_<std::optional<T>> : std::true_type { };
+
+template <typename T, typename = void> struct is_range_ : std::false_type { };
+template <typename T> struct is_range_<T, std::void_t<decltype(std::begin(std::declval<T const&>()) != std::end(std::declval<T const&>()))>> : std::true_type { };
+
+template <typename T, typename ReflectorT>
+constexpr bool
+has_reflected_members(void) noexcept
+{
+    if constexpr (!std::is_class<T>::value) return false;
+    else return metadata::is_available(metadata::members<T, ReflectorT>());
+}
+
+template <typename T, typename ReflectorT> constexpr bool is_bitwise_comparable(void) noexcept;
+
+template <typename T, typename ReflectorT, typename MembersT, std::size_t... Is>
+constexpr bool
+are_members_bitwise_comparable(MembersT const& members, std::index_sequence<Is...>) noexcept
+{
+    (void) members;
+    constexpr std::size_t sizeOfMembers = (std::size_t(0) + ... + sizeof(member_value_t<T, std::tuple_element_t<Is, MembersT>>));
+    return sizeOfMembers == sizeof(T) && (true && ... && detail::is_bitwise_comparable<member_value_t<T, std::tuple_element_t<Is, MembersT>>, ReflectorT>());
+}
+
+    // A type is bitwise comparable if its object representation determines its value, and if all bytes of the object
+    // representation belong to reflected members. Such types can be hashed and compared for equality through their object
+    // representation.
+template <typename T, typename ReflectorT>
+constexpr bool
+is_bitwise_comparable(void) noexcept
+{
+    if constexpr (!std::has_unique_object_representations<T>::value) return false;  // padding, floating-point values
+    else if constexpr (std::is_array<T>::value) return detail::is_bitwise_comparable<std::remove_extent_t<T>, ReflectorT>();
+    else if constexpr (is_std_array_<T>::value) return detail::is_bitwise_comparable<typename T::value_type, ReflectorT>();
+    else if constexpr (std::is_class<T>::value)
+    {
+        if constexpr (!detail::has_reflected_members<T, ReflectorT>()) return false;
+        else
+        {
+            constexpr auto members = metadata::members<T, ReflectorT>();
+            return detail::are_members_bitwise_comparable<T, ReflectorT>(members, std::make_index_sequence<std::tuple_size<decltype(members)>::value>{ });
+        }
+    }
+    else return true;
+}
+
+template <typename ReflectorT, typename T>
+std::uint64_t
+reflected_hash_value(T const& value)
+{
+    if constexpr (detail::is_bitwise_comparable<T, ReflectorT>())
+    {
+        return detail::hash_bytes(&value, sizeof(T));
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+            // Positive and negative zero compare equal and thus must have the same hash.
+        T normalizedValue = value == 0 ? T(0) : value;
+        return detail::hash_bytes(&normalizedValue, sizeof(T));
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        return detail::reflected_hash_value<ReflectorT>(static_cast<std::underlying_type_t<T>>(value));
+    }
+    else if constexpr (std::is_convertible<T const&, std::string_view>::value)
+    {
+        auto str = std::string_view(value);
+        return detail::hash_bytes(str.data(), str.size());
+    }
+    else if constexpr (is_optional_<T>::value)
+    {
+        return value.has_value() ? detail::hash_combine(1, detail::reflected_hash_value<ReflectorT>(*value)) : 0;
+    }
+    else if constexpr (detail::has_reflected_members<T, ReflectorT>())
+    {
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        std::uint64_t result = 0;
+        makeshift::template_for(
+            [&result, &value](auto member)
+            {
+                result = detail::hash_combine(result, detail::reflected_hash_value<ReflectorT>(value.*member));
+            },
+            members);
+        return result;
+    }
+    else if constexpr (is_range_<T>::value)
+    {
+        std::uint64_t result = 0;
+        std::size_t n = 0;
+        for (auto const& elem : value)
+        {
+            result = detail::hash_combine(result, detail::reflected_hash_value<ReflectorT>(elem));
+            ++n;
+        }
+        return detail::hash_combine(result, n);
+    }
+    else
+    {
+        return std::hash<T>{ }(value);
+    }
+}
+
+
+template <typename ReflectorT, typename T>
+bool
+reflected_equal_values(T const& lhs, T const& rhs)
+{
+    if constexpr (std::is_arithmetic<T>::value || std::is_enum<T>::value)
+    {
+        return lhs == rhs;
+    }
+    else if constexpr (detail::is_bitwise_comparable<T, ReflectorT>())
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+    }
+    else if constexpr (std::is_convertible<T const&, std::string_view>::value)
+    {
+        return std::string_view(lhs) == std::string_view(rhs);
+    }
+    else if constexpr (is_optional_<T>::value)
+    {
+        if (lhs.has_value() != rhs.has_value()) return false;
+        return !lhs.has_value() || detail::reflected_equal_values<ReflectorT>(*lhs, *rhs);
+    }
+    else if constexpr (detail::has_reflected_members<T, ReflectorT>())
+    {
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        return makeshift::apply(
+            [&lhs, &rhs](auto... ms)
+            {
+                return (detail::reflected_equal_values<ReflectorT>(lhs.*ms, rhs.*ms) && ...);
+            },
+            members);
+    }
+    else if constexpr (is_range_<T>::value)
+    {
+        return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs),
+            [](auto const& l, auto const& r) { return detail::reflected_equal_values<ReflectorT>(l, r); });
+    }
+    else
+    {
+        return lhs == rhs;
+    }
+}
+
+template <typename ReflectorT, typename T>
+bool
+reflected_less_values(T const& lhs, T const& rhs)
+{
+    if constexpr (std::is_arithmetic<T>::value || std::is_enum<T>::value)
+    {
+        return lhs < rhs;
+    }
+    else if constexpr (std::is_convertible<T const&, std::string_view>::value)
+    {
+        return std::string_view(lhs) < std::string_view(rhs);
+    }
+    else if constexpr (is_optional_<T>::value)
+    {
+        if (!rhs.has_value()) return false;
+        return !lhs.has_value() || detail::reflected_less_values<ReflectorT>(*lhs, *rhs);
+    }
+    else if constexpr (detail::has_reflected_members<T, ReflectorT>())
+    {
+            // Compare members lexicographically, i.e. stop at the first member which is not equivalent.
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        return makeshift::apply(
+            [&lhs, &rhs](auto... ms)
+            {
+                int result = 0;
+                (void) (... || ((result = detail::reflected_less_values<ReflectorT>(lhs.*ms, rhs.*ms) ? -1
+                    : detail::reflected_less_values<ReflectorT>(rhs.*ms, lhs.*ms) ? 1
+                    : 0) != 0));
+                return result < 0;
+            },
+            members);
+    }
+    else if constexpr (is_range_<T>::value)
+    {
+        return std::lexicographical_compare(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs),
+            [](auto const& l, auto const& r) { return detail::reflected_less_values<ReflectorT>(l, r); });
+    }
+    else
+    {
+        return lhs < rhs;
+    }
+}
+
+
+template <typename T, typename ReflectorT, typename MembersT, std::size_t... Is>
+constexpr std::size_t
+members_sort_key_size(MembersT const&, std::index_sequence<Is...>) noexcept;
+
+template <typename T, typename ReflectorT>
+constexpr std::size_t
+sort_key_size(void) noexcept
+{
+    if constexpr (std::is_same<T, bool>::value) return 1;
+    else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) return sizeof(T);
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "sort keys support only single- and double-precision floating-point types");
+        return sizeof(T);
+    }
+    else if constexpr (std::is_array<T>::value) return std::extent<T>::value*detail::sort_key_size<std::remove_extent_t<T>, ReflectorT>();
+    else if constexpr (is_std_array_<T>::value) return std::tuple_size<T>::value*detail::sort_key_size<typename T::value_type, ReflectorT>();
+    else
+    {
+        static_assert(detail::has_reflected_members<T, ReflectorT>(), "sort keys require a fixed-size type with reflected members");
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        return detail::members_sort_key_size<T, ReflectorT>(members, std::make_index_sequence<std::tuple_size<decltype(members)>::value>{ });
+    }
+}
+
+template <typename T, typename ReflectorT, typename MembersT, std::size_t... Is>
+constexpr std::size_t
+members_sort_key_size(MembersT const&, std::index_sequence<Is...>) noexcept
+{
+    return (std::size_t(0) + ... + detail::sort_key_size<member_value_t<T, std::tuple_element_t<Is, MembersT>>, ReflectorT>());
+}
+
+template <typename U>
+std::byte*
+store_big_endian(std::byte* dst, U value) noexcept
+{
+    for (std::size_t i = 0; i != sizeof(U); ++i)
+    {
+        dst[i] = std::byte(value >> (8*(sizeof(U) - 1 - i)));
+    }
+    return dst + sizeof(U);
+}
+
+    // Writes a byte string which compares lexicographically like `value`: unsigned integers are stored in big-endian byte order,
+    // signed integers additionally have their sign bit flipped, and negative floating-point values have all bits flipped.
+template <typename ReflectorT, typename T>
+std::byte*
+write_sort_key(std::byte* dst, T const& value) noexcept
+{
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        *dst = std::byte(value ? 1 : 0);
+        return dst + 1;
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        return detail::write_sort_key<ReflectorT>(dst, static_cast<std::underlying_type_t<T>>(value));
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        using U = std::make_unsigned_t<T>;
+        auto bits = static_cast<U>(value);
+        if constexpr (std::is_signed<T>::value) bits ^= U(U(1) << (8*sizeof(U) - 1));
+        return detail::store_big_endian(dst, bits);
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        using U = unsigned_of_size_t<sizeof(T)>;
+        constexpr U signBit = U(1) << (8*sizeof(U) - 1);
+        U bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        bits = (bits & signBit) != 0 ? U(~bits) : U(bits | signBit);
+        return detail::store_big_endian(dst, bits);
+    }
+    else if constexpr (std::is_array<T>::value || is_std_array_<T>::value)
+    {
+        for (auto const& elem : value)
+        {
+            dst = detail::write_sort_key<ReflectorT>(dst, elem);
+        }
+        return dst;
+    }
+    else
+    {
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        makeshift::template_for(
+            [&dst, &value](auto member)
+            {
+                dst = detail::write_sort_key<ReflectorT>(dst, value.*member);
+            },
+            members);
+        return dst;
+    }
+}
+
+
 } // namespace detail
 
 } // namespace makeshift
@@ -0,0 +1,862 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_JSON_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_JSON_HPP_
+
+
+#include <array>
+#include <cmath>         // for isfinite()
+#include <tuple>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstddef>       // for size_t
+#include <cstdint>       // for uint32_t
+#include <utility>       // for declval<>(), index_sequence<>, move()
+#include <charconv>      // for to_chars(), from_chars()
+#include <optional>
+#include <stdexcept>     // for runtime_error
+#include <ostream>
+#include <iterator>      // for begin(), end()
+#include <string_view>
+#include <type_traits>   // for integral_constant<>, is_arithmetic<>, is_enum<>, is_floating_point<>, is_same<>, is_convertible<>, is_class<>, is_array<>, underlying_type<>, remove_extent<>, extent<>, enable_if<>, void_t<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for index, gsl_Expects(), gsl_Assert()
+
+#include <makeshift/metadata.hpp>     // for metadata::members<>(), metadata::member_names<>(), metadata::values<>(), metadata::is_available()
+#include <makeshift/type_traits.hpp>  // for is_bitmask<>
+
+#include <makeshift/detail/metadata.hpp>   // for member_name_hash_index_v<>, member_visitor_table_v<>
+#include <makeshift/detail/serialize.hpp>  // for static_enum_metadata<>, static_flags_metadata<>, enum_to_string(), try_enum_from_string(), flags_from_string(), trim()
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+    // Character sinks for the JSON writer.
+inline void
+json_write(std::string& sink, std::string_view str)
+{
+    sink.append(str.data(), str.size());
+}
+inline void
+json_write(std::vector<char>& sink, std::string_view str)
+{
+    sink.insert(sink.end(), str.begin(), str.end());
+}
+inline void
+json_write(std::ostream& sink, std::string_view str)
+{
+    sink.write(str.data(), std::streamsize(str.size()));
+}
+
+
+    // Returns the escape sequence for the character `c` in a JSON string, or 0 if `c` needs no escaping. For a return value of
+    // 'u', `c` is written as "\u00XX".
+constexpr char
+json_escape_char(char c) noexcept
+{
+    switch (c)
+    {
+    case '"': return '"';
+    case '\\': return '\\';
+    case '\b': return 'b';
+    case '\f': return 'f';
+    case '\n': return 'n';
+    case '\r': return 'r';
+    case '\t': return 't';
+    default: return static_cast<unsigned char>(c) < 0x20 ? 'u' : 0;
+    }
+}
+
+constexpr std::size_t
+json_escaped_length(std::string_view str) noexcept
+{
+    std::size_t result = 0;
+    for (char c : str)
+    {
+        char e = detail::json_escape_char(c);
+        result += e == 0 ? 1 : e == 'u' ? 6 : 2;
+    }
+    return result;
+}
+
+constexpr char*
+json_escape(char* dst, std::string_view str) noexcept
+{
+    constexpr char hexDigits[] = "0123456789abcdef";
+    for (char c : str)
+    {
+        char e = detail::json_escape_char(c);
+        if (e == 0) *dst++ = c;
+        else
+        {
+            *dst++ = '\\';
+            *dst++ = e;
+            if (e == 'u')
+            {
+                auto uc = static_cast<unsigned char>(c);
+                *dst++ = '0';
+                *dst++ = '0';
+                *dst++ = hexDigits[uc >> 4];
+                *dst++ = hexDigits[uc & 0xF];
+            }
+        }
+    }
+    return dst;
+}
+
+template <typename SinkT>
+void
+write_json_escaped(SinkT& sink, std::string_view str)
+{
+    std::size_t runStart = 0;
+    for (std::size_t i = 0; i != str.size(); ++i)
+    {
+        if (detail::json_escape_char(str[i]) != 0)
+        {
+                // Write runs of characters which need no escaping in one piece.
+            json_write(sink, str.substr(runStart, i - runStart));
+            char buf[6] = { };
+            json_write(sink, std::string_view(buf, std::size_t(detail::json_escape(buf, str.substr(i, 1)) - buf)));
+            runStart = i + 1;
+        }
+    }
+    json_write(sink, str.substr(runStart));
+}
+
+template <typename SinkT>
+void
+write_json_string(SinkT& sink, std::string_view str)
+{
+    json_write(sink, "\"");
+    detail::write_json_escaped(sink, str);
+    json_write(sink, "\"");
+}
+
+
+    // Member keys of a reflected type in their JSON encoding, precomputed at compile time. Every key is quoted, escaped and
+    // followed by a colon. Except for the first key, keys are preceded by a comma, so a key can be written with a single call.
+template <typename T, typename ReflectorT>
+constexpr auto
+json_member_key_offsets(void) noexcept
+{
+    constexpr auto names = metadata::member_names<T, ReflectorT>();
+    constexpr std::size_t numKeys = std::tuple_size<std::remove_const_t<decltype(names)>>::value;
+
+    auto result = std::array<std::size_t, numKeys + 1>{ };
+    for (std::size_t i = 0; i != numKeys; ++i)
+    {
+        result[i + 1] = result[i] + (i != 0 ? 1 : 0) + 1 + detail::json_escaped_length(names[i]) + 2;
+    }
+    return result;
+}
+template <typename T, typename ReflectorT, std::size_t Length>
+constexpr auto
+json_member_key_chars(void) noexcept
+{
+    constexpr auto names = metadata::member_names<T, ReflectorT>();
+    constexpr std::size_t numKeys = std::tuple_size<std::remove_const_t<decltype(names)>>::value;
+
+    auto result = std::array<char, Length>{ };
+    char* dst = result.data();
+    for (std::size_t i = 0; i != numKeys; ++i)
+    {
+        if (i != 0) *dst++ = ',';
+        *dst++ = '"';
+        dst = detail::json_escape(dst, names[i]);
+        *dst++ = '"';
+        *dst++ = ':';
+    }
+    return result;
+}
+template <typename T, typename ReflectorT>
+struct json_member_keys
+{
+    static constexpr auto offsets = detail::json_member_key_offsets<T, ReflectorT>();
+    static constexpr auto chars = detail::json_member_key_chars<T, ReflectorT, offsets.back()>();
+
+    static constexpr std::string_view
+    key(std::size_t i) noexcept
+    {
+        return { chars.data() + offsets[i], offsets[i + 1] - offsets[i] };
+    }
+};
+
+
+template <typename T> struct is_json_optional_ : std::false_type { };
+template <typename T> struct is_json_optional_<std::optional<T>> : std::true_type { };
+
+    // Character arrays hold NUL-terminated strings, or strings of exactly `N` characters if no NUL character is present.
+template <typename T> struct is_json_char_array_ : std::false_type { };
+template <std::size_t N> struct is_json_char_array_<char[N]> : std::true_type { };
+
+template <std::size_t N>
+std::string_view
+char_array_to_string_view(char const (&chars)[N]) noexcept
+{
+    std::size_t n = 0;
+    while (n != N && chars[n] != '\0') ++n;
+    return { chars, n };
+}
+
+template <typename T, typename = void> struct is_json_range_ : std::false_type { };
+template <typename T> struct is_json_range_<T, std::void_t<decltype(std::begin(std::declval<T const&>()) != std::end(std::declval<T const&>()))>> : std::true_type { };
+
+
+template <typename T, typename ReflectorT, typename SinkT>
+void
+write_json_flags(SinkT& sink, T value)
+{
+    constexpr auto const& md = static_flags_metadata<T, ReflectorT>::value;
+    gsl_Expects((value & ~md.all_defined_flags_) == T{ });
+
+    json_write(sink, "\"");
+    if (value == T{ })
+    {
+        detail::write_json_escaped(sink, md.none_name_);
+    }
+    else
+    {
+        auto flagsSet = T{ };
+        for (std::size_t i = 0; i != md.num_individual_names_; ++i)
+        {
+            T flag = md.values_[i];
+            if ((value & flag) != T{ } && (flagsSet & flag) == T{ })
+            {
+                if (flagsSet != T{ })
+                {
+                    json_write(sink, "+");
+                }
+                detail::write_json_escaped(sink, md.names_[i]);
+                flagsSet |= flag;
+            }
+        }
+    }
+    json_write(sink, "\"");
+}
+
+template <typename T, typename SinkT>
+void
+write_json_number(SinkT& sink, T value)
+{
+    if constexpr (std::is_floating_point<T>::value)
+    {
+            // JSON cannot represent infinities and NaN.
+        if (!std::isfinite(value))
+        {
+            json_write(sink, "null");
+            return;
+        }
+    }
+    char buf[64];
+    auto [end, ec] = std::to_chars(buf, buf + sizeof buf, value);
+    gsl_Assert(ec == std::errc{ });
+    json_write(sink, std::string_view(buf, std::size_t(end - buf)));
+}
+
+template <typename ReflectorT, typename SinkT, typename T>
+void write_json(SinkT& sink, T const& value);
+
+template <typename ReflectorT, typename SinkT, typename T, std::size_t... Is>
+void
+write_json_members(SinkT& sink, T const& value, std::index_sequence<Is...>)
+{
+    constexpr auto members = metadata::members<T, ReflectorT>();
+    using Keys = json_member_keys<T, ReflectorT>;
+
+    json_write(sink, "{");
+    (..., (json_write(sink, Keys::key(Is)), detail::write_json<ReflectorT>(sink, value.*std::get<Is>(members))));
+    json_write(sink, "}");
+}
+
+template <typename ReflectorT, typename SinkT, typename T>
+void
+write_json(SinkT& sink, T const& value)
+{
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        json_write(sink, value ? "true" : "false");
+    }
+    else if constexpr (std::is_arithmetic<T>::value)
+    {
+        detail::write_json_number(sink, value);
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        if constexpr (!metadata::is_available(metadata::values<T, ReflectorT>()))
+        {
+            detail::write_json_number(sink, static_cast<std::underlying_type_t<T>>(value));
+        }
+        else if constexpr (is_bitmask<T>::value)
+        {
+            detail::write_json_flags<T, ReflectorT>(sink, value);
+        }
+        else
+        {
+            detail::write_json_string(sink, detail::enum_to_string(value, static_enum_metadata<T, ReflectorT>::value));
+        }
+    }
+    else if constexpr (is_json_char_array_<T>::value)
+    {
+        detail::write_json_string(sink, detail::char_array_to_string_view(value));
+    }
+    else if constexpr (std::is_convertible<T const&, std::string_view>::value)
+    {
+        detail::write_json_string(sink, std::string_view(value));
+    }
+    else if constexpr (is_json_optional_<T>::value)
+    {
+        if (value.has_value()) detail::write_json<ReflectorT>(sink, *value);
+        else json_write(sink, "null");
+    }
+    else if constexpr (is_json_range_<T>::value)
+    {
+        json_write(sink, "[");
+        bool first = true;
+        for (auto const& elem : value)
+        {
+            if (!first) json_write(sink, ",");
+            first = false;
+            detail::write_json<ReflectorT>(sink, elem);
+        }
+        json_write(sink, "]");
+    }
+    else
+    {
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        static_assert(metadata::is_available(members), "JSON encoding requires member metadata for class types");
+
+        detail::write_json_members<ReflectorT>(sink, value, std::make_index_sequence<std::tuple_size<decltype(members)>::value>{ });
+    }
+}
+
+template <typename T> struct is_json_fixed_array_ : std::is_array<T> { };
+template <typename T, std::size_t N> struct is_json_fixed_array_<std::array<T, N>> : std::true_type { };
+
+template <typename T, typename = void> struct is_json_resizable_ : std::false_type { };
+template <typename T> struct is_json_resizable_<T, std::void_t<decltype(std::declval<T&>().push_back(std::declval<typename T::value_type>())), decltype(std::declval<T&>().clear())>> : std::true_type { };
+
+template <typename T, typename = void> struct json_element_ { };
+template <typename T> struct json_element_<T, std::enable_if_t<std::is_array<T>::value>> { using type = std::remove_extent_t<T>; };
+template <typename T> struct json_element_<T, std::enable_if_t<!std::is_array<T>::value>> { using type = typename T::value_type; };
+template <typename T> using json_element_t = typename json_element_<T>::type;
+
+template <typename T>
+constexpr std::size_t
+json_fixed_array_size(void) noexcept
+{
+    if constexpr (std::is_array<T>::value) return std::extent<T>::value;
+    else return std::tuple_size<T>::value;
+}
+
+    // Classes other than strings and ranges are read member by member.
+template <typename T>
+constexpr bool
+is_json_object(void) noexcept
+{
+    return std::is_class<T>::value && !std::is_same<T, std::string>::value && !is_json_optional_<T>::value
+        && !is_json_fixed_array_<T>::value && !is_json_resizable_<T>::value;
+}
+
+
+    // Parses `str` as a number, a boolean, an enumerator or a string and stores it in `value`. Returns `false` if `str` cannot be
+    // parsed.
+template <typename ReflectorT, typename T>
+bool
+parse_text_value(T& value, std::string_view str)
+{
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        if (str == "true") value = true;
+        else if (str == "false") value = false;
+        else return false;
+        return true;
+    }
+    else if constexpr (std::is_arithmetic<T>::value)
+    {
+        auto [end, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+        return ec == std::errc{ } && end == str.data() + str.size();
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        if constexpr (!metadata::is_available(metadata::values<T, ReflectorT>()))
+        {
+            auto underlyingValue = std::underlying_type_t<T>{ };
+            if (!detail::parse_text_value<ReflectorT>(underlyingValue, str)) return false;
+            value = static_cast<T>(underlyingValue);
+            return true;
+        }
+        else if constexpr (is_bitmask<T>::value)
+        {
+            return detail::flags_from_string(value, str, static_flags_metadata<T, ReflectorT>::value, false) == 0;
+        }
+        else
+        {
+            return detail::try_enum_from_string(value, str, static_enum_metadata<T, ReflectorT>::value) == 0;
+        }
+    }
+    else if constexpr (std::is_same<T, std::string>::value)
+    {
+        value.assign(str.data(), str.size());
+        return true;
+    }
+    else if constexpr (is_json_char_array_<T>::value)
+    {
+        constexpr std::size_t n = std::extent<T>::value;
+        if (str.size() > n) return false;
+        std::size_t i = 0;
+        for (; i != str.size(); ++i) value[i] = str[i];
+        for (; i != n; ++i) value[i] = '\0';
+        return true;
+    }
+    else if constexpr (is_json_optional_<T>::value)
+    {
+        if (str.empty())
+        {
+            value.reset();
+            return true;
+        }
+        if (!value.has_value()) value.emplace();
+        return detail::parse_text_value<ReflectorT>(*value, str);
+    }
+    else if constexpr (is_json_fixed_array_<T>::value || is_json_resizable_<T>::value)
+    {
+            // Ranges are given as comma-separated lists.
+        if constexpr (is_json_resizable_<T>::value) value.clear();
+        std::size_t i = 0;
+        while (!str.empty())
+        {
+            std::size_t pos = str.find(',');
+            auto token = detail::trim(str.substr(0, pos));
+            str = pos != std::string_view::npos ? str.substr(pos + 1) : std::string_view{ };
+            if constexpr (is_json_resizable_<T>::value)
+            {
+                auto elem = json_element_t<T>{ };
+                if (!detail::parse_text_value<ReflectorT>(elem, token)) return false;
+                value.push_back(std::move(elem));
+            }
+            else
+            {
+                if (i == detail::json_fixed_array_size<T>() || !detail::parse_text_value<ReflectorT>(value[i], token)) return false;
+                ++i;
+            }
+        }
+        if constexpr (is_json_fixed_array_<T>::value)
+        {
+            if (i != detail::json_fixed_array_size<T>()) return false;
+        }
+        return true;
+    }
+    else
+    {
+        static_assert(detail::is_json_object<T>(), "unsupported type");
+        return false;
+    }
+}
+
+
+    // Invokes `func(member)` for the member of `value` with index `i` through a jump table.
+template <typename ReflectorT, typename T, typename F>
+void
+visit_json_member(T& value, gsl::index i, F&& func)
+{
+    static_assert(metadata::is_available(metadata::members<T, ReflectorT>()), "JSON decoding requires member metadata for class types");
+
+    member_visitor_table_v<T, ReflectorT, std::remove_reference_t<F>>[i](value, func);
+}
+
+
+    // Objects and arrays are parsed recursively. Nesting is limited so that the parser cannot be made to exhaust the stack.
+constexpr int json_max_nesting_depth = 512;
+
+class json_reader
+{
+private:
+    std::string_view input_;
+    std::size_t pos_ = 0;
+    int depth_ = 0;
+    std::string scratch_;
+
+public:
+    class nesting_scope
+    {
+        friend json_reader;
+
+    private:
+        json_reader& reader_;
+
+        explicit nesting_scope(json_reader& reader) noexcept
+            : reader_(reader)
+        {
+        }
+
+    public:
+        nesting_scope(nesting_scope const&) = delete;
+        nesting_scope& operator =(nesting_scope const&) = delete;
+        ~nesting_scope()
+        {
+            --reader_.depth_;
+        }
+    };
+
+    explicit json_reader(std::string_view input)
+        : input_(input)
+    {
+    }
+
+    [[noreturn]] void
+    fail(std::string_view what) const
+    {
+        auto msg = std::string("JSON parse error at offset ");
+        msg += std::to_string(pos_);
+        msg += ": ";
+        msg += what;
+        throw std::runtime_error(msg);
+    }
+
+        // Enters a nested object or array until the returned scope object is destroyed. Fails if the maximal nesting depth is
+        // exceeded.
+    [[nodiscard]] nesting_scope
+    enter_nested(void)
+    {
+        if (depth_ == json_max_nesting_depth) fail("maximal nesting depth exceeded");
+        ++depth_;
+        return nesting_scope(*this);
+    }
+
+    char
+    peek(void) noexcept
+    {
+        while (pos_ != input_.size() && (input_[pos_] == ' ' || input_[pos_] == '\t' || input_[pos_] == '\n' || input_[pos_] == '\r'))
+        {
+            ++pos_;
+        }
+        return pos_ != input_.size() ? input_[pos_] : '\0';
+    }
+    bool
+    try_consume(char c) noexcept
+    {
+        if (peek() != c) return false;
+        ++pos_;
+        return true;
+    }
+    void
+    expect(char c)
+    {
+        if (!try_consume(c))
+        {
+            char msg[] = "expected ' '";
+            msg[10] = c;
+            fail(msg);
+        }
+    }
+    bool
+    try_consume_literal(std::string_view literal) noexcept
+    {
+        peek();
+        if (input_.substr(pos_, literal.size()) != literal) return false;
+        pos_ += literal.size();
+        return true;
+    }
+    void
+    expect_end(void)
+    {
+        if (peek() != '\0' || pos_ != input_.size()) fail("unexpected trailing characters");
+    }
+
+    std::string_view
+    read_number_token(void)
+    {
+        peek();
+        std::size_t start = pos_;
+        while (pos_ != input_.size() && std::string_view("+-0123456789.eE").find(input_[pos_]) != std::string_view::npos)
+        {
+            ++pos_;
+        }
+        if (pos_ == start) fail("expected value");
+        return input_.substr(start, pos_ - start);
+    }
+
+        // Returns a view of the input if the string has no escape sequences. Otherwise, the unescaped string is stored in a
+        // scratch buffer which remains valid until the next call.
+    std::string_view
+    read_string(void)
+    {
+        expect('"');
+        std::size_t start = pos_;
+        while (pos_ != input_.size() && input_[pos_] != '"' && input_[pos_] != '\\' && static_cast<unsigned char>(input_[pos_]) >= 0x20)
+        {
+            ++pos_;
+        }
+        if (pos_ != input_.size() && input_[pos_] == '"')
+        {
+            ++pos_;
+            return input_.substr(start, pos_ - 1 - start);
+        }
+
+        scratch_.assign(input_.data() + start, pos_ - start);
+        for (;;)
+        {
+            if (pos_ == input_.size()) fail("unterminated string");
+            char c = input_[pos_++];
+            if (c == '"') return scratch_;
+            if (static_cast<unsigned char>(c) < 0x20) fail("unescaped control character in string");
+            if (c != '\\')
+            {
+                scratch_ += c;
+                continue;
+            }
+            if (pos_ == input_.size()) fail("unterminated string");
+            switch (c = input_[pos_++])
+            {
+            case '"': case '\\': case '/': scratch_ += c; break;
+            case 'b': scratch_ += '\b'; break;
+            case 'f': scratch_ += '\f'; break;
+            case 'n': scratch_ += '\n'; break;
+            case 'r': scratch_ += '\r'; break;
+            case 't': scratch_ += '\t'; break;
+            case 'u': _append_utf8(_read_code_point()); break;
+            default: fail("invalid escape sequence");
+            }
+        }
+    }
+
+    void
+    skip_value(void)
+    {
+        char c = peek();
+        if (c == '{' || c == '[')
+        {
+            auto scope = enter_nested();
+            ++pos_;
+            char close = c == '{' ? '}' : ']';
+            if (try_consume(close)) return;
+            do
+            {
+                if (c == '{')
+                {
+                    read_string();
+                    expect(':');
+                }
+                skip_value();
+            } while (try_consume(','));
+            expect(close);
+        }
+        else if (c == '"') read_string();
+        else if (!try_consume_literal("true") && !try_consume_literal("false") && !try_consume_literal("null")) read_number_token();
+    }
+
+private:
+    std::uint32_t
+    _read_hex4(void)
+    {
+        if (input_.size() - pos_ < 4) fail("invalid escape sequence");
+        std::uint32_t result = 0;
+        auto [end, ec] = std::from_chars(input_.data() + pos_, input_.data() + pos_ + 4, result, 16);
+        if (ec != std::errc{ } || end != input_.data() + pos_ + 4) fail("invalid escape sequence");
+        pos_ += 4;
+        return result;
+    }
+    std::uint32_t
+    _read_code_point(void)
+    {
+        std::uint32_t cp = _read_hex4();
+        if (cp >= 0xD800 && cp < 0xDC00)
+        {
+                // UTF-16 surrogate pair
+            if (input_.substr(pos_, 2) != "\\u") fail("invalid surrogate pair");
+            pos_ += 2;
+            std::uint32_t low = _read_hex4();
+            if (low < 0xDC00 || low >= 0xE000) fail("invalid surrogate pair");
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        }
+        else if (cp >= 0xDC00 && cp < 0xE000) fail("invalid surrogate pair");
+        return cp;
+    }
+    void
+    _append_utf8(std::uint32_t cp)
+    {
+        if (cp < 0x80) scratch_ += char(cp);
+        else if (cp < 0x800)
+        {
+            scratch_ += char(0xC0 | (cp >> 6));
+            scratch_ += char(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000)
+        {
+            scratch_ += char(0xE0 | (cp >> 12));
+            scratch_ += char(0x80 | ((cp >> 6) & 0x3F));
+            scratch_ += char(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            scratch_ += char(0xF0 | (cp >> 18));
+            scratch_ += char(0x80 | ((cp >> 12) & 0x3F));
+            scratch_ += char(0x80 | ((cp >> 6) & 0x3F));
+            scratch_ += char(0x80 | (cp & 0x3F));
+        }
+    }
+};
+
+
+template <typename ReflectorT, typename T>
+void
+read_json(json_reader& reader, T& value)
+{
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        if (reader.try_consume_literal("true")) value = true;
+        else if (reader.try_consume_literal("false")) value = false;
+        else reader.fail("expected boolean");
+    }
+    else if constexpr (std::is_arithmetic<T>::value)
+    {
+        if constexpr (std::is_floating_point<T>::value)
+        {
+                // `to_json()` encodes non-finite values as `null`.
+            if (reader.try_consume_literal("null"))
+            {
+                value = std::numeric_limits<T>::quiet_NaN();
+                return;
+            }
+        }
+        if (!detail::parse_text_value<ReflectorT>(value, reader.read_number_token())) reader.fail("invalid number");
+    }
+    else if constexpr (std::is_enum<T>::value && !metadata::is_available(metadata::values<T, ReflectorT>()))
+    {
+        if (!detail::parse_text_value<ReflectorT>(value, reader.read_number_token())) reader.fail("invalid number");
+    }
+    else if constexpr (std::is_enum<T>::value || std::is_same<T, std::string>::value)
+    {
+        if (reader.peek() != '"') reader.fail("expected string");
+        if (!detail::parse_text_value<ReflectorT>(value, reader.read_string())) reader.fail("unknown enumerator");
+    }
+    else if constexpr (is_json_char_array_<T>::value)
+    {
+        if (reader.peek() != '"') reader.fail("expected string");
+        if (!detail::parse_text_value<ReflectorT>(value, reader.read_string())) reader.fail("string too long");
+    }
+    else if constexpr (is_json_optional_<T>::value)
+    {
+        if (reader.try_consume_literal("null")) value.reset();
+        else
+        {
+            if (!value.has_value()) value.emplace();
+            detail::read_json<ReflectorT>(reader, *value);
+        }
+    }
+    else if constexpr (is_json_fixed_array_<T>::value)
+    {
+        auto scope = reader.enter_nested();
+        reader.expect('[');
+        for (std::size_t i = 0; i != detail::json_fixed_array_size<T>(); ++i)
+        {
+            if (i != 0) reader.expect(',');
+            detail::read_json<ReflectorT>(reader, value[i]);
+        }
+        reader.expect(']');
+    }
+    else if constexpr (is_json_resizable_<T>::value)
+    {
+        auto scope = reader.enter_nested();
+        reader.expect('[');
+        value.clear();
+        if (reader.try_consume(']')) return;
+        do
+        {
+            auto elem = json_element_t<T>{ };
+            detail::read_json<ReflectorT>(reader, elem);
+            value.push_back(std::move(elem));
+        } while (reader.try_consume(','));
+        reader.expect(']');
+    }
+    else
+    {
+        constexpr auto const& index = member_name_hash_index_v<T, ReflectorT>;
+
+        auto scope = reader.enter_nested();
+        reader.expect('{');
+        if (reader.try_consume('}')) return;
+        do
+        {
+                // The key is dispatched before the value is read, so it may refer to the reader's scratch buffer.
+            gsl::index i = index.search(reader.read_string());
+            reader.expect(':');
+            if (i < 0) reader.skip_value();  // ignore unknown members
+            else detail::visit_json_member<ReflectorT>(value, i, [&reader](auto& member) { detail::read_json<ReflectorT>(reader, member); });
+        } while (reader.try_consume(','));
+        reader.expect('}');
+    }
+}
+
+
+    // Assigns the textual value `str` to the member of `value` denoted by the possibly dotted key `key`. Returns -1 if there is
+    // no such member, and 0 if `str` cannot be parsed.
+template <typename ReflectorT, typename T>
+int
+assign_kv(T& value, std::string_view key, std::string_view str)
+{
+    constexpr auto const& index = member_name_hash_index_v<T, ReflectorT>;
+
+    std::size_t dot = key.find('.');
+    gsl::index i = index.search(key.substr(0, dot));
+    if (i < 0) return -1;
+    int result = -1;
+    detail::visit_json_member<ReflectorT>(value, i,
+        [&](auto& member)
+        {
+            using M = std::remove_reference_t<decltype(member)>;
+            if constexpr (detail::is_json_object<M>())
+            {
+                if (dot != std::string_view::npos) result = detail::assign_kv<ReflectorT>(member, key.substr(dot + 1), str);
+            }
+            else
+            {
+                if (dot == std::string_view::npos) result = detail::parse_text_value<ReflectorT>(member, str) ? 1 : 0;
+            }
+        });
+    return result;
+}
+
+template <typename ReflectorT, typename T>
+void
+read_kv(T& value, std::string_view text)
+{
+    std::size_t lineNumber = 0;
+    while (!text.empty())
+    {
+        ++lineNumber;
+        std::size_t eol = text.find('\n');
+        auto line = detail::trim(text.substr(0, eol));
+        text = eol != std::string_view::npos ? text.substr(eol + 1) : std::string_view{ };
+        if (line.empty() || line.front() == '#') continue;
+
+        auto error = [lineNumber, line](std::string_view what)
+        {
+            auto msg = std::string("line ");
+            msg += std::to_string(lineNumber);
+            msg += ": ";
+            msg += what;
+            msg += " in '";
+            msg += line;
+            msg += "'";
+            throw std::runtime_error(msg);
+        };
+
+        std::size_t eq = line.find('=');
+        if (eq == std::string_view::npos) error("expected 'key = value'");
+        int result = detail::assign_kv<ReflectorT>(value, detail::trim(line.substr(0, eq)), detail::trim(line.substr(eq + 1)));
+        if (result < 0) error("unknown key");
+        if (result == 0) error("invalid value");
+    }
+}
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_JSON_HPP_
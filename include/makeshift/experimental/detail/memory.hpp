@@ -0,0 +1,150 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_MEMORY_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_MEMORY_HPP_
+
+
+#include <new>      // for operator new(), operator delete()
+#include <cstddef>  // for size_t, byte
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+struct arena_block
+{
+    arena_block* next;
+    std::size_t size;  // payload size in bytes
+
+    [[nodiscard]] std::byte* payload(void) noexcept
+    {
+        return reinterpret_cast<std::byte*>(this + 1);
+    }
+};
+
+[[nodiscard]] inline arena_block*
+allocate_arena_block(std::size_t size, arena_block* next)
+{
+    auto block = static_cast<arena_block*>(::operator new(sizeof(arena_block) + size));
+    block->next = next;
+    block->size = size;
+    return block;
+}
+
+inline void
+free_arena_blocks(arena_block* block) noexcept
+{
+    while (block != nullptr)
+    {
+        arena_block* next = block->next;
+        ::operator delete(block);
+        block = next;
+    }
+}
+
+
+    // Memory blocks handed out by `pool_allocator<>` are grouped in size classes of 16, 32, 64, ..., 4096 bytes. Every thread keeps
+    // a bounded free list of released blocks for every size class.
+constexpr std::size_t pool_min_block_size = 16;
+constexpr std::size_t pool_num_size_classes = 9;
+constexpr std::size_t pool_max_block_size = pool_min_block_size << (pool_num_size_classes - 1);
+constexpr std::size_t pool_max_cached_blocks = 64;
+
+[[nodiscard]] constexpr std::size_t
+pool_size_class(std::size_t size) noexcept
+{
+    std::size_t sizeClass = 0;
+    while ((pool_min_block_size << sizeClass) < size)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+struct pool_free_block
+{
+    pool_free_block* next;
+};
+
+struct pool_free_list
+{
+    pool_free_block* head;
+    std::size_t count;
+};
+
+    // Thread-local state is trivially destructible so it can be accessed safely while other thread-local objects are being
+    // destroyed; the cached blocks are released by `pool_cache_guard` at thread exit.
+inline thread_local pool_free_list pool_free_lists[pool_num_size_classes] = { };
+inline thread_local bool pool_cache_released = false;
+
+struct pool_cache_guard
+{
+    ~pool_cache_guard()
+    {
+        for (auto& list : pool_free_lists)
+        {
+            while (list.head != nullptr)
+            {
+                pool_free_block* next = list.head->next;
+                ::operator delete(list.head);
+                list.head = next;
+            }
+            list.count = 0;
+        }
+        pool_cache_released = true;
+    }
+};
+
+[[nodiscard]] inline void*
+pool_allocate(std::size_t size)
+{
+    if (size > pool_max_block_size)
+    {
+        return ::operator new(size);
+    }
+    std::size_t sizeClass = detail::pool_size_class(size);
+    auto& list = pool_free_lists[sizeClass];
+    if (list.head != nullptr)
+    {
+        pool_free_block* block = list.head;
+        list.head = block->next;
+        --list.count;
+        return block;
+    }
+    return ::operator new(pool_min_block_size << sizeClass);
+}
+
+inline void
+pool_deallocate(void* ptr, std::size_t size) noexcept
+{
+    if (size > pool_max_block_size)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    std::size_t sizeClass = detail::pool_size_class(size);
+    auto& list = pool_free_lists[sizeClass];
+    if (pool_cache_released || list.count == pool_max_cached_blocks)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    if (list.count == 0)
+    {
+        thread_local pool_cache_guard guard;
+        (void) guard;
+    }
+    auto block = static_cast<pool_free_block*>(ptr);
+    block->next = list.head;
+    list.head = block;
+    ++list.count;
+}
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_MEMORY_HPP_
@@ -0,0 +1,346 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_PARALLEL_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_PARALLEL_HPP_
+
+
+#include <deque>
+#include <mutex>
+#include <tuple>
+#include <atomic>
+#include <memory>              // for unique_ptr<>
+#include <thread>
+#include <vector>
+#include <cstddef>             // for size_t
+#include <utility>             // for move(), forward<>(), integer_sequence<>
+#include <optional>
+#include <exception>           // for exception_ptr, current_exception(), rethrow_exception()
+#include <type_traits>         // for decay<>
+#include <condition_variable>
+
+#include <makeshift/detail/tuple-transform.hpp>  // for transform_element<>()
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+struct parallel_task
+{
+    void (*run)(void* job, std::size_t index);
+    void* job;
+    std::size_t index;
+};
+
+
+    // A simple work-stealing thread pool. Every worker owns a task queue; tasks submitted by a worker are pushed onto its own
+    // queue, whereas tasks submitted by other threads are distributed over all queues. Workers take tasks from the back of their
+    // own queue and steal from the front of other queues when their own queue is empty. Threads waiting for a task group to
+    // finish execute pending tasks themselves, so nested parallel invocations cannot deadlock, and block when no task is left.
+class work_stealing_pool
+{
+private:
+    struct task_queue
+    {
+        std::mutex mutex;
+        std::deque<parallel_task> tasks;
+    };
+
+    std::vector<std::unique_ptr<task_queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> numPending_{ 0 };
+    std::atomic<std::size_t> nextQueue_{ 0 };
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+    static constexpr std::size_t no_queue = std::size_t(-1);
+
+        // Index of the queue owned by the current thread, or `no_queue` if the current thread is not a worker.
+    static std::size_t& _own_queue(void) noexcept
+    {
+        static thread_local std::size_t ownQueue = no_queue;
+        return ownQueue;
+    }
+
+    bool _try_pop(std::size_t q, bool fromBack, parallel_task& task)
+    {
+        auto& queue = *queues_[q];
+        auto lock = std::lock_guard<std::mutex>(queue.mutex);
+        if (queue.tasks.empty()) return false;
+        if (fromBack)
+        {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+        }
+        return true;
+    }
+
+    void _worker(std::size_t q)
+    {
+        _own_queue() = q;
+        for (;;)
+        {
+            if (try_run_one(q)) continue;
+
+            auto lock = std::unique_lock<std::mutex>(sleepMutex_);
+            wake_.wait(lock, [&] { return stop_ || numPending_.load() != 0; });
+            if (stop_) return;
+        }
+    }
+
+public:
+    explicit work_stealing_pool(std::size_t numThreads)
+    {
+        std::size_t numQueues = numThreads != 0 ? numThreads : 1;
+        queues_.reserve(numQueues);
+        for (std::size_t q = 0; q != numQueues; ++q)
+        {
+            queues_.push_back(std::make_unique<task_queue>());
+        }
+        threads_.reserve(numThreads);
+        for (std::size_t t = 0; t != numThreads; ++t)
+        {
+            threads_.emplace_back([this, t] { _worker(t); });
+        }
+    }
+    work_stealing_pool(work_stealing_pool const&) = delete;
+    work_stealing_pool& operator =(work_stealing_pool const&) = delete;
+    ~work_stealing_pool()
+    {
+        {
+            auto lock = std::lock_guard<std::mutex>(sleepMutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    static work_stealing_pool& instance(void)
+    {
+        static work_stealing_pool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1);
+        return pool;
+    }
+
+        // Returns the index of the queue from which the current thread should preferably take tasks.
+    std::size_t preferred_queue(void) noexcept
+    {
+        std::size_t q = _own_queue();
+        return q != no_queue ? q : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+
+    void submit(parallel_task const* tasks, std::size_t numTasks)
+    {
+        std::size_t q = _own_queue();
+        if (q != no_queue)
+        {
+            auto& queue = *queues_[q];
+            auto lock = std::lock_guard<std::mutex>(queue.mutex);
+            queue.tasks.insert(queue.tasks.end(), tasks, tasks + numTasks);
+        }
+        else
+        {
+            for (std::size_t i = 0; i != numTasks; ++i)
+            {
+                auto& queue = *queues_[nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size()];
+                auto lock = std::lock_guard<std::mutex>(queue.mutex);
+                queue.tasks.push_back(tasks[i]);
+            }
+        }
+        {
+            auto lock = std::lock_guard<std::mutex>(sleepMutex_);
+            numPending_ += numTasks;
+        }
+        wake_.notify_all();
+    }
+
+        // Runs a pending task, preferably one from the given queue. Returns `false` if no task was pending.
+    bool try_run_one(std::size_t preferredQueue)
+    {
+        std::size_t numQueues = queues_.size();
+        parallel_task task;
+        bool found = _try_pop(preferredQueue % numQueues, true, task);
+        for (std::size_t d = 1; !found && d != numQueues; ++d)
+        {
+            found = _try_pop((preferredQueue + d) % numQueues, false, task);
+        }
+        if (!found) return false;
+        --numPending_;
+        task.run(task.job, task.index);
+        return true;
+    }
+
+        // Blocks until `isDone()` returns `true` or until tasks are pending. `notify_done()` must be called after the state
+        // observed by `isDone()` has changed.
+    template <typename DoneF>
+    void wait(DoneF&& isDone)
+    {
+        auto lock = std::unique_lock<std::mutex>(sleepMutex_);
+        wake_.wait(lock, [&] { return isDone() || numPending_.load() != 0; });
+    }
+    void notify_done(void)
+    {
+        {
+                // Synchronize with waiting threads which have evaluated `isDone()` but not yet started waiting.
+            auto lock = std::lock_guard<std::mutex>(sleepMutex_);
+        }
+        wake_.notify_all();
+    }
+};
+
+
+template <std::size_t N>
+struct parallel_job_base
+{
+    std::atomic<std::size_t> remaining{ N };
+    std::exception_ptr errors[N];
+
+    template <typename JobT>
+    void execute(void)
+    {
+        auto& pool = work_stealing_pool::instance();
+
+            // The calling thread executes the first task itself.
+        parallel_task tasks[N];
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            tasks[i] = parallel_task{ &JobT::run, this, i };
+        }
+        pool.submit(tasks + 1, N - 1);
+        JobT::run(this, 0);
+
+        std::size_t q = pool.preferred_queue();
+        auto isDone = [this] { return remaining.load(std::memory_order_acquire) == 0; };
+        while (!isDone())
+        {
+            if (!pool.try_run_one(q)) pool.wait(isDone);
+        }
+
+            // Propagate the exception of the lowest-indexed failing task.
+        for (auto const& error : errors)
+        {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+};
+
+template <typename JobT, std::size_t N>
+struct parallel_job : parallel_job_base<N>
+{
+    void execute(void)
+    {
+        parallel_job_base<N>::template execute<JobT>();
+    }
+
+    template <std::size_t... Is>
+    static void dispatch(JobT& self, std::size_t i, std::index_sequence<Is...>)
+    {
+        using Run = void (*)(JobT&);
+        static constexpr Run table[] = { &JobT::template run_element<Is>... };
+        table[i](self);
+    }
+
+    static void run(void* job, std::size_t i)
+    {
+        auto& self = *static_cast<JobT*>(static_cast<parallel_job_base<N>*>(job));
+        try
+        {
+            parallel_job::dispatch(self, i, std::make_index_sequence<N>{ });
+        }
+        catch (...)
+        {
+            self.errors[i] = std::current_exception();
+        }
+        if (self.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            work_stealing_pool::instance().notify_done();
+        }
+    }
+};
+
+template <std::size_t N, typename F, typename... Ts>
+struct template_for_parallel_job : parallel_job<template_for_parallel_job<N, F, Ts...>, N>
+{
+    F& func;
+    std::tuple<Ts&&...> args;
+
+    template_for_parallel_job(F& _func, Ts&&... _args)
+        : func(_func), args(std::forward<Ts>(_args)...)
+    {
+    }
+
+    template <std::size_t I>
+    static void run_element(template_for_parallel_job& self)
+    {
+        std::apply(
+            [&self](auto&&... args)
+            {
+                detail::transform_element<I>(self.func, std::forward<decltype(args)>(args)...);
+            },
+            std::move(self.args));
+    }
+};
+
+    // Chunk executor for `radix_sort_permutation<>()` which processes the chunks on the thread pool.
+struct parallel_chunk_executor
+{
+    static constexpr bool is_concurrent = true;
+
+    template <typename F, typename ChunkIndicesT>
+    static void
+    run(F& func, ChunkIndicesT const& chunkIndices)
+    {
+        auto job = template_for_parallel_job<std::tuple_size<ChunkIndicesT>::value, F, ChunkIndicesT const&>(func, chunkIndices);
+        job.execute();
+    }
+};
+
+template <typename Is, typename F, typename... Ts>
+struct tuple_transform_parallel_job_;
+template <std::size_t... Is, typename F, typename... Ts>
+struct tuple_transform_parallel_job_<std::index_sequence<Is...>, F, Ts...>
+    : parallel_job<tuple_transform_parallel_job_<std::index_sequence<Is...>, F, Ts...>, sizeof...(Is)>
+{
+    F& func;
+    std::tuple<Ts&&...> args;
+    std::tuple<std::optional<std::decay_t<decltype(detail::transform_element<Is>(std::declval<F&>(), std::declval<Ts>()...))>>...> results;
+
+    tuple_transform_parallel_job_(F& _func, Ts&&... _args)
+        : func(_func), args(std::forward<Ts>(_args)...)
+    {
+    }
+
+    template <std::size_t I>
+    static void run_element(tuple_transform_parallel_job_& self)
+    {
+        std::apply(
+            [&self](auto&&... args)
+            {
+                std::get<I>(self.results).emplace(detail::transform_element<I>(self.func, std::forward<decltype(args)>(args)...));
+            },
+            std::move(self.args));
+    }
+
+    auto take_results(void)
+    {
+        return std::tuple<typename std::tuple_element_t<Is, decltype(results)>::value_type...>(std::move(*std::get<Is>(results))...);
+    }
+};
+template <std::size_t N, typename F, typename... Ts>
+using tuple_transform_parallel_job = tuple_transform_parallel_job_<std::make_index_sequence<N>, F, Ts...>;
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_PARALLEL_HPP_
@@ -0,0 +1,433 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_SERIALIZE_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_SERIALIZE_HPP_
+
+
+#include <array>
+#include <tuple>
+#include <cstddef>      // for size_t, byte
+#include <cstring>      // for memcpy(), memcmp(), memset()
+#include <utility>      // for index_sequence<>
+#include <type_traits>  // for integral_constant<>, is_arithmetic<>, is_enum<>, is_class<>, is_same<>, is_trivially_copyable<>, is_trivially_default_constructible<>, underlying_type<>, remove_const<>, remove_reference<>, remove_all_extents<>, extent<>
+
+#include <makeshift/metadata.hpp>  // for metadata::members<>(), metadata::is_available()
+
+#include <makeshift/experimental/detail/type_traits.hpp>  // for member_value_t<>, member_pointer_class_t<>, is_std_array_<>, unsigned_of_size_t<>
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+    // Multi-byte scalars are encoded in little-endian byte order. On little-endian hosts, the in-memory representation of
+    // arithmetic types is identical to their encoding, which permits copying them with `memcpy()`.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+constexpr inline bool host_is_little_endian = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#elif defined(_WIN32)
+constexpr inline bool host_is_little_endian = true;
+#else
+constexpr inline bool host_is_little_endian = false;  // conservatively use the byte-wise encoding
+#endif
+
+
+
+    // A type is "raw" if its encoding is identical to its object representation.
+template <typename T>
+[[nodiscard]] constexpr bool
+is_raw_binary(void) noexcept
+{
+    if constexpr (std::is_same<T, bool>::value) return false;
+    else if constexpr (std::is_arithmetic<T>::value || std::is_enum<T>::value) return sizeof(T) == 1 || host_is_little_endian;
+    else if constexpr (std::is_array<T>::value) return detail::is_raw_binary<std::remove_all_extents_t<T>>();
+    else if constexpr (is_std_array_<T>::value) return sizeof(T) == sizeof(typename T::value_type)*std::tuple_size<T>::value && detail::is_raw_binary<typename T::value_type>();
+    else return false;
+}
+
+template <typename T, typename ReflectorT>
+[[nodiscard]] constexpr std::size_t
+binary_size(void) noexcept;
+
+template <typename T, typename ReflectorT, typename MembersT> struct members_binary_info_;
+template <typename T, typename ReflectorT, typename... Ms>
+struct members_binary_info_<T, ReflectorT, std::tuple<Ms...>>
+{
+    static constexpr std::size_t size = (detail::binary_size<member_value_t<T, Ms>, ReflectorT>() + ... + 0);
+    static constexpr std::array<std::size_t, sizeof...(Ms)> binary_sizes = { detail::binary_size<member_value_t<T, Ms>, ReflectorT>()... };
+    static constexpr std::array<bool, sizeof...(Ms)> is_raw = { detail::is_raw_binary<member_value_t<T, Ms>>()... };
+    static constexpr std::array<std::size_t, sizeof...(Ms)> sizes = { sizeof(member_value_t<T, Ms>)... };
+
+        // Returns the end of the run of raw members starting at index `i`.
+    [[nodiscard]] static constexpr std::size_t
+    raw_run_end(std::size_t i) noexcept
+    {
+        while (i != sizeof...(Ms) && is_raw[i]) ++i;
+        return i;
+    }
+    [[nodiscard]] static constexpr std::size_t
+    raw_run_size(std::size_t first, std::size_t last) noexcept
+    {
+        std::size_t result = 0;
+        for (std::size_t i = first; i != last; ++i) result += sizes[i];
+        return result;
+    }
+
+        // Returns the offset of the encoding of member `i` in the encoding of `T`.
+    [[nodiscard]] static constexpr std::size_t
+    binary_offset(std::size_t i) noexcept
+    {
+        std::size_t result = 0;
+        for (std::size_t j = 0; j != i; ++j) result += binary_sizes[j];
+        return result;
+    }
+};
+template <typename T, typename ReflectorT>
+using members_binary_info = members_binary_info_<T, ReflectorT, std::remove_const_t<std::remove_reference_t<decltype(metadata::members<T, ReflectorT>())>>>;
+
+template <typename T, typename ReflectorT>
+[[nodiscard]] constexpr std::size_t
+binary_size(void) noexcept
+{
+    if constexpr (std::is_same<T, bool>::value) return 1;
+    else if constexpr (std::is_arithmetic<T>::value || std::is_enum<T>::value)
+    {
+            // The object representation of `long double` has a platform-dependent size and may contain padding bytes.
+        static_assert(!std::is_same<T, long double>::value, "long double has no portable binary encoding");
+        return sizeof(T);
+    }
+    else if constexpr (std::is_array<T>::value) return std::extent<T>::value*detail::binary_size<std::remove_extent_t<T>, ReflectorT>();
+    else if constexpr (is_std_array_<T>::value) return std::tuple_size<T>::value*detail::binary_size<typename T::value_type, ReflectorT>();
+    else
+    {
+        static_assert(metadata::is_available(metadata::members<T, ReflectorT>()), "type must be arithmetic, an enum, an array, or have reflected members");
+        return members_binary_info<T, ReflectorT>::size;
+    }
+}
+
+
+    // Value-initialized instance of `T` whose member addresses can be compared in constant expressions. `T` must be a literal
+    // type, which is guaranteed for trivially copyable and trivially default-constructible classes.
+template <typename T> constexpr T layout_probe{ };
+
+template <typename T, typename M1, typename M2>
+[[nodiscard]] constexpr bool
+precedes_member(M1 m1, M2 m2) noexcept
+{
+    if constexpr (std::is_same<member_pointer_class_t<M1>, member_pointer_class_t<M2>>::value)
+    {
+        return static_cast<void const*>(&(layout_probe<T>.*m1)) < static_cast<void const*>(&(layout_probe<T>.*m2));
+    }
+    else
+    {
+            // Members of a base class are laid out before the members of the derived class.
+        return true;
+    }
+}
+template <typename T, typename MembersT, std::size_t... Is>
+[[nodiscard]] constexpr bool
+are_members_in_layout_order(MembersT const& members, std::index_sequence<Is...>) noexcept
+{
+    return (detail::precedes_member<T>(std::get<Is>(members), std::get<Is + 1>(members)) && ...);
+}
+
+    // A type is layout-compatible with its binary encoding if its object representation is identical to the encoding, which is
+    // the case for raw types and for trivially copyable classes without padding whose layout-compatible members are declared in
+    // the order in which they are reflected. The declaration order can only be checked at compile time for trivially
+    // default-constructible classes; other classes are conservatively considered incompatible.
+template <typename T, typename ReflectorT>
+[[nodiscard]] constexpr bool
+is_binary_layout_compatible(void) noexcept
+{
+    if constexpr (detail::is_raw_binary<T>()) return true;
+    else if constexpr (!std::is_class<T>::value || !std::is_trivially_copyable<T>::value || is_std_array_<T>::value) return false;
+    else if constexpr (!std::is_trivially_default_constructible<T>::value) return false;
+    else if constexpr (!metadata::is_available(metadata::members<T, ReflectorT>())) return false;
+    else
+    {
+        constexpr auto members = metadata::members<T, ReflectorT>();
+        constexpr std::size_t numMembers = std::tuple_size<decltype(members)>::value;
+        constexpr bool membersCompatible = std::apply(
+            [](auto... ms)
+            {
+                return (detail::is_binary_layout_compatible<member_value_t<T, decltype(ms)>, ReflectorT>() && ...);
+            },
+            members);
+        if constexpr (!membersCompatible || numMembers == 0) return false;
+        else if constexpr (sizeof(T) != members_binary_info<T, ReflectorT>::size) return false;
+        else return detail::are_members_in_layout_order<T>(members, std::make_index_sequence<numMembers - 1>{ });
+    }
+}
+
+
+template <typename T>
+void
+store_little_endian(std::byte* dst, T value) noexcept
+{
+    using U = unsigned_of_size_t<sizeof(T)>;
+    U bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    for (std::size_t i = 0; i != sizeof(T); ++i)
+    {
+        dst[i] = std::byte(bits >> (8*i) & 0xFF);
+    }
+}
+template <typename T>
+[[nodiscard]] T
+load_little_endian(std::byte const* src) noexcept
+{
+    using U = unsigned_of_size_t<sizeof(T)>;
+    U bits = 0;
+    for (std::size_t i = 0; i != sizeof(T); ++i)
+    {
+        bits |= U(U(src[i]) << (8*i));
+    }
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+
+    // Checks whether the members in [I, I + sizeof...(Ks) + 1) are laid out back to back. Member offsets are constant, so
+    // compilers reduce this to a constant.
+template <std::size_t I, typename T, typename MembersT, std::size_t... Ks>
+[[nodiscard]] bool
+are_members_contiguous(T const& value, MembersT const& members, std::index_sequence<Ks...>) noexcept
+{
+    auto address = [&value](auto member)
+    {
+        return reinterpret_cast<std::byte const*>(&(value.*member));
+    };
+    return ((address(std::get<I + Ks>(members)) + sizeof(value.*std::get<I + Ks>(members)) == address(std::get<I + Ks + 1>(members))) && ...);
+}
+
+template <typename ReflectorT, typename T>
+std::byte* write_binary(std::byte* dst, T const& value) noexcept;
+
+template <typename ReflectorT, std::size_t I, typename T>
+std::byte*
+write_binary_members(std::byte* dst, T const& value) noexcept
+{
+    using Info = members_binary_info<T, ReflectorT>;
+    constexpr auto members = metadata::members<T, ReflectorT>();
+
+    if constexpr (I == std::tuple_size<decltype(members)>::value) return dst;
+    else
+    {
+        constexpr std::size_t runEnd = Info::raw_run_end(I);
+        if constexpr (runEnd - I > 1)
+        {
+                // Copy runs of adjacent raw members with a single `memcpy()`.
+            constexpr std::size_t runSize = Info::raw_run_size(I, runEnd);
+            if (detail::are_members_contiguous<I>(value, members, std::make_index_sequence<runEnd - I - 1>{ }))
+            {
+                std::memcpy(dst, &(value.*std::get<I>(members)), runSize);
+                return detail::write_binary_members<ReflectorT, runEnd>(dst + runSize, value);
+            }
+        }
+        dst = detail::write_binary<ReflectorT>(dst, value.*std::get<I>(members));
+        return detail::write_binary_members<ReflectorT, I + 1>(dst, value);
+    }
+}
+
+template <typename ReflectorT, typename T>
+std::byte*
+write_binary(std::byte* dst, T const& value) noexcept
+{
+    if constexpr (detail::is_raw_binary<T>())
+    {
+        std::memcpy(dst, &value, sizeof(T));
+        return dst + sizeof(T);
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        *dst = std::byte(value ? 1 : 0);
+        return dst + 1;
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        detail::store_little_endian(dst, static_cast<std::underlying_type_t<T>>(value));
+        return dst + sizeof(T);
+    }
+    else if constexpr (std::is_arithmetic<T>::value)
+    {
+        detail::store_little_endian(dst, value);
+        return dst + sizeof(T);
+    }
+    else if constexpr (std::is_array<T>::value || is_std_array_<T>::value)
+    {
+        for (auto const& elem : value)
+        {
+            dst = detail::write_binary<ReflectorT>(dst, elem);
+        }
+        return dst;
+    }
+    else
+    {
+        return detail::write_binary_members<ReflectorT, 0>(dst, value);
+    }
+}
+
+template <typename ReflectorT, typename T>
+std::byte const* read_binary(std::byte const* src, T& value) noexcept;
+
+template <typename ReflectorT, std::size_t I, typename T>
+std::byte const*
+read_binary_members(std::byte const* src, T& value) noexcept
+{
+    using Info = members_binary_info<T, ReflectorT>;
+    constexpr auto members = metadata::members<T, ReflectorT>();
+
+    if constexpr (I == std::tuple_size<decltype(members)>::value) return src;
+    else
+    {
+        constexpr std::size_t runEnd = Info::raw_run_end(I);
+        if constexpr (runEnd - I > 1)
+        {
+            constexpr std::size_t runSize = Info::raw_run_size(I, runEnd);
+            if (detail::are_members_contiguous<I>(value, members, std::make_index_sequence<runEnd - I - 1>{ }))
+            {
+                std::memcpy(&(value.*std::get<I>(members)), src, runSize);
+                return detail::read_binary_members<ReflectorT, runEnd>(src + runSize, value);
+            }
+        }
+        src = detail::read_binary<ReflectorT>(src, value.*std::get<I>(members));
+        return detail::read_binary_members<ReflectorT, I + 1>(src, value);
+    }
+}
+
+template <typename ReflectorT, typename T>
+std::byte const*
+read_binary(std::byte const* src, T& value) noexcept
+{
+    if constexpr (detail::is_raw_binary<T>())
+    {
+        std::memcpy(&value, src, sizeof(T));
+        return src + sizeof(T);
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        value = *src != std::byte(0);
+        return src + 1;
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        value = static_cast<T>(detail::load_little_endian<std::underlying_type_t<T>>(src));
+        return src + sizeof(T);
+    }
+    else if constexpr (std::is_arithmetic<T>::value)
+    {
+        value = detail::load_little_endian<T>(src);
+        return src + sizeof(T);
+    }
+    else if constexpr (std::is_array<T>::value || is_std_array_<T>::value)
+    {
+        for (auto& elem : value)
+        {
+            src = detail::read_binary<ReflectorT>(src, elem);
+        }
+        return src;
+    }
+    else
+    {
+        return detail::read_binary_members<ReflectorT, 0>(src, value);
+    }
+}
+
+
+    // A patch consists of a bitmask with one bit per member, where bit `i % 8` of byte `i / 8` indicates whether member `i`
+    // has changed, followed by the encodings of the changed members in member order.
+template <typename T, typename ReflectorT>
+[[nodiscard]] constexpr std::size_t
+patch_mask_size(void) noexcept
+{
+    static_assert(metadata::is_available(metadata::members<T, ReflectorT>()), "type must have reflected members");
+    return (std::tuple_size<std::remove_const_t<std::remove_reference_t<decltype(metadata::members<T, ReflectorT>())>>>::value + 7)/8;
+}
+
+    // Writes the encoding of `newValue` to `dst` and returns whether it differs from the encoding of `oldValue`. Encodings rather
+    // than values are compared, so a change of the sign of zero is detected whereas an unchanged NaN is not.
+template <typename ReflectorT, typename T>
+[[nodiscard]] bool
+write_binary_if_changed(std::byte* dst, T const& oldValue, T const& newValue) noexcept
+{
+    constexpr std::size_t size = detail::binary_size<T, ReflectorT>();
+    detail::write_binary<ReflectorT>(dst, newValue);
+    if constexpr (detail::is_binary_layout_compatible<T, ReflectorT>())
+    {
+        return std::memcmp(dst, &oldValue, size) != 0;
+    }
+    else
+    {
+        std::byte oldBytes[size];
+        detail::write_binary<ReflectorT>(oldBytes, oldValue);
+        return std::memcmp(dst, oldBytes, size) != 0;
+    }
+}
+
+template <typename ReflectorT, std::size_t I, typename T>
+std::byte*
+write_member_patch(std::byte* mask, std::byte* dst, T const& oldValue, T const& newValue) noexcept
+{
+    using Info = members_binary_info<T, ReflectorT>;
+    constexpr auto members = metadata::members<T, ReflectorT>();
+
+    if (!detail::write_binary_if_changed<ReflectorT>(dst, oldValue.*std::get<I>(members), newValue.*std::get<I>(members))) return dst;
+    mask[I/8] |= std::byte(1u << (I % 8));
+    return dst + Info::binary_sizes[I];
+}
+
+template <typename ReflectorT, typename T, std::size_t... Is>
+std::byte*
+write_patch(std::byte* dst, T const& oldValue, T const& newValue, std::index_sequence<Is...>) noexcept
+{
+    constexpr std::size_t maskSize = detail::patch_mask_size<T, ReflectorT>();
+    std::byte* mask = dst;
+    std::memset(mask, 0, maskSize);
+    dst += maskSize;
+    ((dst = detail::write_member_patch<ReflectorT, Is>(mask, dst, oldValue, newValue)), ...);
+    return dst;
+}
+
+template <typename ReflectorT, std::size_t I, typename T>
+std::byte const*
+read_member_binary(std::byte const* src, T& value) noexcept
+{
+    constexpr auto members = metadata::members<T, ReflectorT>();
+    return detail::read_binary<ReflectorT>(src, value.*std::get<I>(members));
+}
+
+template <typename T> using member_reader = std::byte const* (*)(std::byte const* src, T& value) noexcept;
+
+template <typename T, typename ReflectorT, std::size_t... Is>
+constexpr std::array<member_reader<T>, sizeof...(Is)>
+make_member_reader_table(std::index_sequence<Is...>) noexcept
+{
+    return { &detail::read_member_binary<ReflectorT, Is, T>... };
+}
+template <typename T, typename ReflectorT>
+constexpr inline auto member_reader_table_v = detail::make_member_reader_table<T, ReflectorT>(
+    std::make_index_sequence<std::tuple_size<std::remove_const_t<std::remove_reference_t<decltype(metadata::members<T, ReflectorT>())>>>::value>{ });
+
+    // Calls `func(i)` for the index `i` of every member whose bit is set in `mask`. Zero bytes are skipped, so the cost is
+    // dominated by the number of changed members.
+template <typename F>
+void
+for_each_patch_member(std::byte const* mask, std::size_t maskSize, F&& func)
+{
+    for (std::size_t k = 0; k != maskSize; ++k)
+    {
+        unsigned bits = unsigned(mask[k]);
+        for (std::size_t b = 0; bits != 0; ++b, bits >>= 1)
+        {
+            if ((bits & 1) != 0) func(8*k + b);
+        }
+    }
+}
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_SERIALIZE_HPP_
@@ -0,0 +1,204 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_SOA_VECTOR_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_SOA_VECTOR_HPP_
+
+
+#include <tuple>
+#include <cstddef>      // for size_t, ptrdiff_t, byte
+#include <utility>      // for index_sequence<>
+#include <type_traits>  // for remove_const<>, remove_reference<>, is_same<>, is_const<>, conditional<>, conjunction<>, integral_constant<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects()
+
+#include <makeshift/tuple.hpp>        // for template_for()
+#include <makeshift/metadata.hpp>     // for metadata::members<>()
+#include <makeshift/type_traits.hpp>  // for nth_type<>
+
+#include <makeshift/experimental/detail/type_traits.hpp>  // for member_value_t<>, member_pointer_class_t<>
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+    // Columns of a `soa_vector<>` are aligned to the size of a cache line by default, which also satisfies the alignment
+    // requirements of common SIMD instruction sets.
+constexpr std::size_t soa_default_alignment = 64;
+
+template <std::size_t Alignment>
+[[nodiscard]] constexpr std::size_t
+soa_padded_column_size(std::size_t numBytes) noexcept
+{
+    return (numBytes + Alignment - 1)/Alignment*Alignment;
+}
+
+    // All columns are stored in a single memory block; every column is padded to a multiple of `Alignment` bytes.
+template <std::size_t Alignment, typename... Ts>
+[[nodiscard]] constexpr std::size_t
+soa_block_size(std::size_t capacity) noexcept
+{
+    return (detail::soa_padded_column_size<Alignment>(capacity*sizeof(Ts)) + ... + 0);
+}
+
+template <typename T, std::size_t Alignment>
+[[nodiscard]] T*
+soa_next_column(std::byte* block, std::size_t& offset, std::size_t capacity) noexcept
+{
+    T* column = reinterpret_cast<T*>(block + offset);
+    offset += detail::soa_padded_column_size<Alignment>(capacity*sizeof(T));
+    return column;
+}
+
+template <std::size_t Alignment, typename... Ts>
+[[nodiscard]] std::tuple<Ts*...>
+soa_column_pointers(std::byte* block, std::size_t capacity) noexcept
+{
+    std::size_t offset = 0;
+        // The elements of a braced initializer list are evaluated from left to right.
+    return std::tuple<Ts*...>{ detail::soa_next_column<Ts, Alignment>(block, offset, capacity)... };
+}
+
+
+template <template <typename...> class SoAT, typename MembersT> struct soa_from_members_;
+template <template <typename...> class SoAT, typename... Ms> struct soa_from_members_<SoAT, std::tuple<Ms...>> { using type = SoAT<member_value_t<member_pointer_class_t<Ms>, Ms>...>; };
+template <template <typename...> class SoAT, typename MembersT> using soa_from_members_t = typename soa_from_members_<SoAT, std::remove_const_t<std::remove_reference_t<MembersT>>>::type;
+
+
+template <typename M1, typename M2>
+[[nodiscard]] constexpr bool
+is_same_member(M1 m1, M2 m2) noexcept
+{
+    if constexpr (std::is_same<M1, M2>::value)
+    {
+        return m1 == m2;
+    }
+    else
+    {
+        return false;
+    }
+}
+template <typename MembersT, typename M, std::size_t... Is>
+[[nodiscard]] constexpr std::size_t
+search_member_index_0(MembersT const& members, M m, std::index_sequence<Is...>) noexcept
+{
+    std::size_t result = std::size_t(-1);
+    (void) ((detail::is_same_member(std::get<Is>(members), m) && (result = Is, true)) || ...);
+    return result;
+}
+template <typename T, typename ReflectorT, typename M>
+[[nodiscard]] constexpr std::size_t
+search_member_index(M m) noexcept
+{
+    constexpr auto members = metadata::members<T, ReflectorT>();
+    return detail::search_member_index_0(members, m, std::make_index_sequence<std::tuple_size<decltype(members)>::value>{ });
+}
+
+
+    // Proxy reference to an element of a `soa_of<>` container. Members can be accessed by member pointer, and the element can be
+    // converted to and assigned from the reflected type `T`.
+template <typename T, typename ReflectorT, typename... Ts>
+class soa_record_reference
+{
+private:
+    static constexpr bool isConst = std::conjunction_v<std::is_const<Ts>...>;
+
+    std::tuple<Ts*...> data_;
+    std::ptrdiff_t index_;
+
+public:
+    constexpr soa_record_reference(std::tuple<Ts*...> const& _data, std::ptrdiff_t _index) noexcept
+        : data_(_data), index_(_index)
+    {
+    }
+
+    soa_record_reference(soa_record_reference const&) = default;
+    constexpr soa_record_reference& operator =(soa_record_reference const& rhs)
+    {
+        makeshift::template_for(
+            [dstIndex = index_, srcIndex = rhs.index_]
+            (auto* dst, auto* src)
+            {
+                dst[dstIndex] = src[srcIndex];
+            },
+            data_, rhs.data_);
+        return *this;
+    }
+
+        // Assigns the members of `value` to the element.
+    constexpr soa_record_reference& operator =(T const& value)
+    {
+        makeshift::template_for<sizeof...(Ts)>(
+            [this, &value](auto iC)
+            {
+                constexpr auto member = std::get<decltype(iC)::value>(metadata::members<T, ReflectorT>());
+                std::get<decltype(iC)::value>(data_)[index_] = value.*member;
+            },
+            tuple_index);
+        return *this;
+    }
+
+        // Gathers the members of the element into an object of type `T`, which must be default-constructible.
+    [[nodiscard]] constexpr operator T(void) const
+    {
+        T result{ };
+        makeshift::template_for<sizeof...(Ts)>(
+            [this, &result](auto iC)
+            {
+                constexpr auto member = std::get<decltype(iC)::value>(metadata::members<T, ReflectorT>());
+                result.*member = std::get<decltype(iC)::value>(data_)[index_];
+            },
+            tuple_index);
+        return result;
+    }
+
+        // Returns a reference to the member `M` of the element.
+    template <auto M>
+    [[nodiscard]] constexpr auto&
+    member(void) const noexcept
+    {
+        constexpr std::size_t i = detail::search_member_index<T, ReflectorT>(M);
+        static_assert(i != std::size_t(-1), "M is not a reflected member of T");
+        return std::get<i>(data_)[index_];
+    }
+
+        // Returns a reference to the member `m` of the element, which must be one of the reflected members of `T`.
+    template <typename C, typename DT>
+    [[nodiscard]] constexpr std::conditional_t<isConst, DT const, DT>&
+    operator ->*(DT C::* m) const
+    {
+        std::conditional_t<isConst, DT const, DT>* result = nullptr;
+        makeshift::template_for<sizeof...(Ts)>(
+            [this, m, &result](auto iC)
+            {
+                constexpr auto member = std::get<decltype(iC)::value>(metadata::members<T, ReflectorT>());
+                if constexpr (std::is_same<decltype(member), DT C::* const>::value)
+                {
+                    if (member == m) result = &std::get<decltype(iC)::value>(data_)[index_];
+                }
+            },
+            tuple_index);
+        gsl_Expects(result != nullptr);
+        return *result;
+    }
+
+        // Implement tuple-like interface for `soa_record_reference<>`.
+    template <std::size_t I>
+    [[nodiscard]] friend constexpr nth_type_t<I, Ts...>& get(soa_record_reference const& self) noexcept
+    {
+        return std::get<I>(self.data_)[self.index_];
+    }
+};
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+    // Implement tuple-like interface for `soa_record_reference<>`.
+template <typename T, typename ReflectorT, typename... Ts> struct std::tuple_size<makeshift::detail::soa_record_reference<T, ReflectorT, Ts...>> : public std::integral_constant<std::size_t, sizeof...(Ts)> { };
+template <std::size_t I, typename T, typename ReflectorT, typename... Ts> struct std::tuple_element<I, makeshift::detail::soa_record_reference<T, ReflectorT, Ts...>> { using type = makeshift::nth_type_t<I, Ts...>; };
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_SOA_VECTOR_HPP_
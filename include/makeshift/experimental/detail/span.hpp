@@ -33,30 +33,48 @@ class soa_span_iterator;
 template <typename... Ts>
 class soa_reference;
 
+
+    // Returns a tuple of pointers each of which is advanced by `n` elements.
 template <typename... Ts>
-class soa_reference
+[[nodiscard]] constexpr std::tuple<Ts*...>
+offset_pointers(std::tuple<Ts*...> const& pointers, std::ptrdiff_t n) noexcept
 {
-    template <typename... RTs> friend class makeshift::soa_span;
-    template <typename... RTs> friend class detail::soa_span_iterator;
+    return std::apply(
+        [n](auto*... ps)
+        {
+            return std::tuple<Ts*...>{ (ps + n)... };
+        },
+        pointers);
+}
+
 
+    // Proxy reference to an element of a struct-of-arrays range. Holds a pointer to the element in every column by value, so it
+    // remains valid as long as the elements do, and member accesses do not have to go through the owning range.
+template <typename... Ts>
+class soa_reference
+{
 private:
-    std::tuple<std::remove_cv_t<Ts>*...> const& data_;
-    std::ptrdiff_t index_;
+    std::tuple<std::remove_cv_t<Ts>*...> data_;
 
-    constexpr soa_reference(std::tuple<std::remove_cv_t<Ts>*...> const& _data, std::ptrdiff_t _index)
-        : data_(_data), index_(_index)
+public:
+        // Constructs a reference to the element at the given pointers, or to the element `_index` positions ahead. Used by the
+        // struct-of-arrays ranges and containers which hand out references.
+    explicit constexpr soa_reference(std::tuple<std::remove_cv_t<Ts>*...> const& _data) noexcept
+        : data_(_data)
+    {
+    }
+    constexpr soa_reference(std::tuple<std::remove_cv_t<Ts>*...> const& _data, std::ptrdiff_t _index) noexcept
+        : data_(detail::offset_pointers(_data, _index))
     {
     }
 
-public:
     soa_reference(soa_reference const&) = default;
     constexpr soa_reference& operator =(soa_reference const& rhs) noexcept
     {
         makeshift::template_for(
-            [dstIndex = index_, srcIndex = rhs.index_]
-            (auto* dst, auto* src)
+            [](auto* dst, auto* src)
             {
-                dst[dstIndex] = src[srcIndex];
+                *dst = *src;
             },
             data_, rhs.data_);
         return *this;
@@ -64,10 +82,9 @@ public:
     constexpr soa_reference& operator =(std::tuple<std::remove_cv_t<Ts>...> const& rhs) noexcept
     {
         makeshift::template_for(
-            [index = index_]
-            (auto* dst, auto const& val)
+            [](auto* dst, auto const& val)
             {
-                dst[index] = val;
+                *dst = val;
             },
             data_, rhs);
         return *this;
@@ -75,10 +92,9 @@ public:
     [[nodiscard]] constexpr operator std::tuple<std::remove_cv_t<Ts>...>(void) const noexcept
     {
         return makeshift::tuple_transform(
-            [index = index_]
-            (auto* p)
+            [](auto* p)
             {
-                return p[index];
+                return *p;
             },
             data_);
     }
@@ -87,7 +103,7 @@ public:
     template <std::size_t I>
     [[nodiscard]] friend constexpr nth_type_t<I, Ts...>& get(soa_reference const& self) noexcept
     {
-        return std::get<I>(self.data_)[self.index_];
+        return *std::get<I>(self.data_);
     }
 };
 
@@ -107,19 +123,28 @@ swap(soa_reference<Ts...> const& lhs, soa_reference<Ts...> const& rhs) noexcept
 }
 
 
+    // Random-access iterator over a struct-of-arrays range. Holds a pointer to the current element in every column; advancing the
+    // iterator advances all pointers. Iterators are independent of the range object they were obtained from.
 template <typename... Ts>
 class soa_span_iterator
 {
-    template <typename... RTs> friend class makeshift::soa_span;
     template <typename... RTs> friend class detail::soa_span_iterator;
 
 private:
-    std::tuple<std::remove_cv_t<Ts>*...> const* data_;
-    std::ptrdiff_t index_;
+    std::tuple<std::remove_cv_t<Ts>*...> data_;
 
-    constexpr soa_span_iterator(std::tuple<std::remove_cv_t<Ts>*...> const* _data, std::ptrdiff_t _index)
-        : data_(_data), index_(_index)
+    constexpr void _advance(std::ptrdiff_t n) noexcept
+    {
+        makeshift::template_for(
+            [n](auto*& p)
+            {
+                p += n;
+            },
+            data_);
+    }
+    [[nodiscard]] constexpr auto _first(void) const noexcept
     {
+        return std::get<0>(data_);
     }
 
 public:
@@ -130,97 +155,108 @@ public:
     using iterator_category = std::input_iterator_tag;  // Unfortunately we cannot be a legacy random-access iterator because of the proxy class.
     using iterator_concept = std::random_access_iterator_tag;  // We can be a non-legacy random access iterator though in C++20.
 
+        // Constructs an iterator to the element `_index` positions ahead of the given pointers. Used by the struct-of-arrays
+        // ranges and containers which hand out iterators.
+    constexpr soa_span_iterator(std::tuple<std::remove_cv_t<Ts>*...> const& _data, std::ptrdiff_t _index) noexcept
+        : data_(detail::offset_pointers(_data, _index))
+    {
+    }
     template <typename... RTs,
               std::enable_if_t<std::conjunction_v<std::is_const<Ts>..., std::negation<std::is_const<RTs>>..., std::is_same<Ts, const RTs>...>, int> = 0>
         constexpr soa_span_iterator(soa_span_iterator<RTs...> const& rhs) noexcept
-            : data_(rhs.data_), index_(rhs.index_)
+            : data_(rhs.data_)
     {
     }
     soa_span_iterator(soa_span_iterator const&) = default;
     soa_span_iterator& operator =(soa_span_iterator const&) = default;
 
-    [[nodiscard]] constexpr reference operator *(void) const
+    [[nodiscard]] constexpr reference operator *(void) const noexcept
     {
-        return { *data_, index_ };
+        return reference(data_);
     }
-    [[nodiscard]] reference operator [](difference_type n) const
+    [[nodiscard]] constexpr reference operator [](difference_type n) const noexcept
     {
-        return { *data_, index_ + n };
+        return { data_, n };
     }
-    constexpr soa_span_iterator& operator ++(void)
+    constexpr soa_span_iterator& operator ++(void) noexcept
     {
-        ++index_;
+        _advance(1);
         return *this;
     }
-    constexpr soa_span_iterator operator ++(int)
+    constexpr soa_span_iterator operator ++(int) noexcept
     {
-        auto result = soa_span_iterator<Ts...>{ *this };
-        ++index_;
+        auto result = *this;
+        _advance(1);
         return result;
     }
-    constexpr soa_span_iterator& operator +=(difference_type n)
+    constexpr soa_span_iterator& operator +=(difference_type n) noexcept
     {
-        index_ += n;
+        _advance(n);
         return *this;
     }
-    constexpr soa_span_iterator& operator --(void)
+    constexpr soa_span_iterator& operator --(void) noexcept
     {
-        --index_;
+        _advance(-1);
         return *this;
     }
-    constexpr soa_span_iterator operator --(int)
+    constexpr soa_span_iterator operator --(int) noexcept
     {
-        auto result = soa_span_iterator<Ts...>{ *this };
-        --index_;
+        auto result = *this;
+        _advance(-1);
         return result;
     }
-    [[nodiscard]] friend constexpr soa_span_iterator operator +(soa_span_iterator it, difference_type n)
+    constexpr soa_span_iterator& operator -=(difference_type n) noexcept
+    {
+        _advance(-n);
+        return *this;
+    }
+    [[nodiscard]] friend constexpr soa_span_iterator operator +(soa_span_iterator it, difference_type n) noexcept
     {
-        it.index_ += n;
+        it._advance(n);
         return it;
     }
-    [[nodiscard]] friend constexpr soa_span_iterator operator +(difference_type n, soa_span_iterator it)
+    [[nodiscard]] friend constexpr soa_span_iterator operator +(difference_type n, soa_span_iterator it) noexcept
     {
-        it.index_ += n;
+        it._advance(n);
         return it;
     }
-    [[nodiscard]] friend constexpr soa_span_iterator operator -(soa_span_iterator it, difference_type n)
+    [[nodiscard]] friend constexpr soa_span_iterator operator -(soa_span_iterator it, difference_type n) noexcept
     {
-        it.index_ -= n;
+        it._advance(-n);
         return it;
     }
-    [[nodiscard]] friend constexpr difference_type operator -(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+    [[nodiscard]] friend constexpr difference_type operator -(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
-        return lhs.index_ - rhs.index_;
+        return lhs._first() - rhs._first();
     }
 
     friend constexpr void swap(soa_span_iterator& lhs, soa_span_iterator& rhs) noexcept
     {
         std::swap(lhs.data_, rhs.data_);
-        std::swap(lhs.index_, rhs.index_);
     }
 
-    [[nodiscard]] friend constexpr bool operator ==(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+        // All columns advance in lockstep, so it suffices to compare the pointers to the first column.
+    [[nodiscard]] friend constexpr bool operator ==(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
-        return lhs.index_ == rhs.index_;
+        return lhs._first() == rhs._first();
     }
-    [[nodiscard]] friend constexpr bool operator !=(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+    [[nodiscard]] friend constexpr bool operator !=(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
         return !(lhs == rhs);
     }
-    [[nodiscard]] friend constexpr bool operator <(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+    [[nodiscard]] friend constexpr bool operator <(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
-        return lhs.index_ < rhs.index_;
+        return lhs._first() < rhs._first();
     }
-    [[nodiscard]] friend constexpr bool operator >(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+    [[nodiscard]] friend constexpr bool operator >(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
         return rhs < lhs;
     }
-    [[nodiscard]] friend constexpr bool operator <=(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+    [[nodiscard]] friend constexpr bool operator <=(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
         return !(rhs < lhs);
     }
-    [[nodiscard]] friend constexpr bool operator >=(soa_span_iterator const& lhs, soa_span_iterator const& rhs)
+    [[nodiscard]] friend constexpr bool operator >=(soa_span_iterator const& lhs, soa_span_iterator const& rhs) noexcept
     {
         return !(lhs < rhs);
     }
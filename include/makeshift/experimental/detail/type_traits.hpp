@@ -0,0 +1,40 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_TYPE_TRAITS_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_TYPE_TRAITS_HPP_
+
+
+#include <array>
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <utility>      // for declval<>()
+#include <type_traits>  // for integral_constant<>, remove_const<>, remove_reference<>
+
+
+namespace makeshift {
+
+namespace detail {
+
+
+template <std::size_t N> struct unsigned_of_size_;
+template <> struct unsigned_of_size_<1> { using type = std::uint8_t; };
+template <> struct unsigned_of_size_<2> { using type = std::uint16_t; };
+template <> struct unsigned_of_size_<4> { using type = std::uint32_t; };
+template <> struct unsigned_of_size_<8> { using type = std::uint64_t; };
+template <std::size_t N> using unsigned_of_size_t = typename unsigned_of_size_<N>::type;
+
+template <typename T> struct is_std_array_ : std::false_type { };
+template <typename T, std::size_t N> struct is_std_array_<std::array<T, N>> : std::true_type { };
+
+template <typename M> struct member_pointer_class_;
+template <typename C, typename DT> struct member_pointer_class_<DT C::*> { using type = C; };
+template <typename M> using member_pointer_class_t = typename member_pointer_class_<M>::type;
+
+template <typename T, typename M> using member_value_t = std::remove_const_t<std::remove_reference_t<decltype(std::declval<T const&>().*std::declval<M>())>>;
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_TYPE_TRAITS_HPP_
@@ -0,0 +1,524 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_VIEWS_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_VIEWS_HPP_
+
+
+#include <cstddef>      // for size_t
+#include <limits>       // for numeric_limits<>
+#include <utility>      // for move(), forward<>()
+#include <iterator>     // for iterator_traits<>, input_iterator_tag, forward_iterator_tag, bidirectional_iterator_tag, random_access_iterator_tag
+#include <type_traits>  // for conditional<>, is_base_of<>, is_reference<>, is_same<>, invoke_result<>, remove_cv<>, remove_reference<>, declval<>()
+
+#include <gsl-lite/gsl-lite.hpp>  // for index, diff, size(), ssize(), gsl_Expects()
+
+#include <makeshift/ranges.hpp>  // for index_range
+
+#include <makeshift/detail/macros.hpp>  // for MAKESHIFT_DETAIL_FORCEINLINE
+#include <makeshift/detail/zip.hpp>     // for range_begin(), range_end()
+
+
+namespace makeshift {
+
+namespace gsl = ::gsl_lite;
+
+namespace detail {
+
+
+template <typename It, typename = void> struct view_iterator_concept_ { using type = typename std::iterator_traits<It>::iterator_category; };
+template <typename It> struct view_iterator_concept_<It, std::void_t<typename It::iterator_concept>> { using type = typename It::iterator_concept; };
+template <typename It> using view_iterator_concept_t = typename view_iterator_concept_<It>::type;
+template <typename It> using view_iterator_category_t = typename std::iterator_traits<It>::iterator_category;
+
+    // Weakens the iterator tag `TagT` to at most `MaxTagT`.
+template <typename TagT, typename MaxTagT> using clamp_iterator_tag = std::conditional_t<std::is_base_of<MaxTagT, TagT>::value, MaxTagT, TagT>;
+
+template <typename R> using view_base_iterator_t = decltype(detail::range_begin(std::declval<R const&>()));
+
+template <typename R>
+constexpr void
+check_common_range(void)
+{
+    static_assert(std::is_same<view_base_iterator_t<R>, decltype(detail::range_end(std::declval<R const&>()))>::value,
+        "views can only be built on common ranges, i.e. ranges whose begin and end iterators have the same type");
+}
+
+constexpr gsl::index unbounded_index = std::numeric_limits<gsl::index>::max();
+
+    // Computes `first + d`, clamped to `last`.
+constexpr gsl::index
+clamped_offset(gsl::index first, gsl::diff d, gsl::index last) noexcept
+{
+    return d < last - first ? first + d : last;
+}
+
+template <typename It>
+MAKESHIFT_DETAIL_FORCEINLINE constexpr void
+advance_bounded(It& it, gsl::diff n, It const& end)
+{
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, view_iterator_concept_t<It>>::value)
+    {
+        gsl::diff remaining = end - it;
+        it += n < remaining ? n : remaining;
+    }
+    else
+    {
+        for (; n != 0 && it != end; --n)
+        {
+            ++it;
+        }
+    }
+}
+
+
+template <typename F, typename G>
+struct composed_function
+{
+    F f;
+    G g;
+
+    template <typename... ArgsT>
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr decltype(auto)
+    operator ()(ArgsT&&... args) const
+    {
+        return g(f(std::forward<ArgsT>(args)...));
+    }
+};
+
+template <typename P, typename Q>
+struct conjoined_predicate
+{
+    P p;
+    Q q;
+
+    template <typename T>
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr bool
+    operator ()(T&& arg) const
+    {
+        return p(arg) && q(arg);
+    }
+};
+
+
+template <typename It, typename F>
+class transform_view_iterator
+{
+    template <typename R, typename G> friend struct transform_range;
+
+private:
+    It pos_;
+    F const* func_ = nullptr;
+
+    constexpr transform_view_iterator(It _pos, F const* _func)
+        : pos_(std::move(_pos)), func_(_func)
+    {
+    }
+
+public:
+    using difference_type = typename std::iterator_traits<It>::difference_type;
+    using reference = std::invoke_result_t<F const&, typename std::iterator_traits<It>::reference>;
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+    using pointer = void;
+    using iterator_category = std::conditional_t<std::is_reference<reference>::value,
+        clamp_iterator_tag<view_iterator_category_t<It>, std::random_access_iterator_tag>,
+        std::input_iterator_tag>;  // We cannot be a legacy forward iterator if we return prvalues.
+    using iterator_concept = clamp_iterator_tag<view_iterator_concept_t<It>, std::random_access_iterator_tag>;
+
+    constexpr transform_view_iterator(void) = default;
+
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator *(void) const
+    {
+        return (*func_)(*pos_);
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator [](difference_type d) const
+    {
+        return (*func_)(pos_[d]);
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr transform_view_iterator& operator ++(void)
+    {
+        ++pos_;
+        return *this;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr transform_view_iterator operator ++(int)
+    {
+        auto result = *this;
+        ++pos_;
+        return result;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr transform_view_iterator& operator --(void)
+    {
+        --pos_;
+        return *this;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr transform_view_iterator operator --(int)
+    {
+        auto result = *this;
+        --pos_;
+        return result;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr transform_view_iterator& operator +=(difference_type d)
+    {
+        pos_ += d;
+        return *this;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr transform_view_iterator& operator -=(difference_type d)
+    {
+        pos_ -= d;
+        return *this;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr transform_view_iterator operator +(transform_view_iterator it, difference_type d)
+    {
+        it.pos_ += d;
+        return it;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr transform_view_iterator operator +(difference_type d, transform_view_iterator it)
+    {
+        it.pos_ += d;
+        return it;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr transform_view_iterator operator -(transform_view_iterator it, difference_type d)
+    {
+        it.pos_ -= d;
+        return it;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr difference_type operator -(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return lhs.pos_ - rhs.pos_;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator ==(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator !=(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator <(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return lhs.pos_ < rhs.pos_;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator >(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return rhs < lhs;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator <=(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return !(rhs < lhs);
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator >=(transform_view_iterator const& lhs, transform_view_iterator const& rhs)
+    {
+        return !(lhs < rhs);
+    }
+};
+
+template <typename It, typename P>
+class filter_view_iterator
+{
+    template <typename R, typename Q> friend struct filter_range;
+
+private:
+    It pos_;
+    It end_;
+    P const* pred_ = nullptr;
+
+    constexpr filter_view_iterator(It _pos, It _end, P const* _pred)
+        : pos_(std::move(_pos)), end_(std::move(_end)), pred_(_pred)
+    {
+        _satisfy();
+    }
+
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr void _satisfy(void)
+    {
+        while (pos_ != end_ && !(*pred_)(*pos_))
+        {
+            ++pos_;
+        }
+    }
+
+public:
+    using difference_type = typename std::iterator_traits<It>::difference_type;
+    using reference = typename std::iterator_traits<It>::reference;
+    using value_type = typename std::iterator_traits<It>::value_type;
+    using pointer = void;
+    using iterator_category = clamp_iterator_tag<view_iterator_category_t<It>, std::bidirectional_iterator_tag>;
+    using iterator_concept = clamp_iterator_tag<view_iterator_concept_t<It>, std::bidirectional_iterator_tag>;
+
+    constexpr filter_view_iterator(void) = default;
+
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator *(void) const
+    {
+        return *pos_;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr filter_view_iterator& operator ++(void)
+    {
+        ++pos_;
+        _satisfy();
+        return *this;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr filter_view_iterator operator ++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr filter_view_iterator& operator --(void)
+    {
+        do
+        {
+            --pos_;
+        } while (!(*pred_)(*pos_));
+        return *this;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr filter_view_iterator operator --(int)
+    {
+        auto result = *this;
+        --*this;
+        return result;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator ==(filter_view_iterator const& lhs, filter_view_iterator const& rhs)
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator !=(filter_view_iterator const& lhs, filter_view_iterator const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <typename It>
+class stride_view_iterator
+{
+    template <typename R> friend struct stride_range;
+
+private:
+    It pos_;
+    It end_;
+    gsl::diff stride_ = 1;
+
+    constexpr stride_view_iterator(It _pos, It _end, gsl::diff _stride)
+        : pos_(std::move(_pos)), end_(std::move(_end)), stride_(_stride)
+    {
+    }
+
+public:
+    using difference_type = typename std::iterator_traits<It>::difference_type;
+    using reference = typename std::iterator_traits<It>::reference;
+    using value_type = typename std::iterator_traits<It>::value_type;
+    using pointer = void;
+    using iterator_category = clamp_iterator_tag<view_iterator_category_t<It>, std::forward_iterator_tag>;
+    using iterator_concept = clamp_iterator_tag<view_iterator_concept_t<It>, std::forward_iterator_tag>;
+
+    constexpr stride_view_iterator(void) = default;
+
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE constexpr reference operator *(void) const
+    {
+        return *pos_;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr stride_view_iterator& operator ++(void)
+    {
+        detail::advance_bounded(pos_, stride_, end_);
+        return *this;
+    }
+    MAKESHIFT_DETAIL_FORCEINLINE constexpr stride_view_iterator operator ++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator ==(stride_view_iterator const& lhs, stride_view_iterator const& rhs)
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+    [[nodiscard]] MAKESHIFT_DETAIL_FORCEINLINE friend constexpr bool operator !=(stride_view_iterator const& lhs, stride_view_iterator const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+
+    // The view types hold the underlying range by reference if it was passed as an lvalue, and by value otherwise.
+
+template <typename R, typename F>
+struct transform_range
+{
+    R base_range;
+    F func;
+
+    using iterator = transform_view_iterator<view_base_iterator_t<R>, F>;
+
+    [[nodiscard]] constexpr iterator
+    begin(void) const
+    {
+        return iterator(detail::range_begin(base_range), &func);
+    }
+    [[nodiscard]] constexpr iterator
+    end(void) const
+    {
+        return iterator(detail::range_end(base_range), &func);
+    }
+    template <typename R2 = R, typename = decltype(gsl::size(std::declval<R2 const&>()))>
+    [[nodiscard]] constexpr std::size_t
+    size(void) const
+    {
+        return std::size_t(gsl::size(base_range));
+    }
+};
+
+template <typename R, typename P>
+struct filter_range
+{
+    R base_range;
+    P pred;
+
+    using iterator = filter_view_iterator<view_base_iterator_t<R>, P>;
+
+    [[nodiscard]] constexpr iterator
+    begin(void) const
+    {
+        return iterator(detail::range_begin(base_range), detail::range_end(base_range), &pred);
+    }
+    [[nodiscard]] constexpr iterator
+    end(void) const
+    {
+        return iterator(detail::range_end(base_range), detail::range_end(base_range), &pred);
+    }
+};
+
+template <typename R>
+struct stride_range
+{
+    R base_range;
+    gsl::diff stride;
+
+    using iterator = stride_view_iterator<view_base_iterator_t<R>>;
+
+    [[nodiscard]] constexpr iterator
+    begin(void) const
+    {
+        return iterator(detail::range_begin(base_range), detail::range_end(base_range), stride);
+    }
+    [[nodiscard]] constexpr iterator
+    end(void) const
+    {
+        return iterator(detail::range_end(base_range), detail::range_end(base_range), stride);
+    }
+    template <typename R2 = R, typename = decltype(gsl::size(std::declval<R2 const&>()))>
+    [[nodiscard]] constexpr std::size_t
+    size(void) const
+    {
+        auto n = gsl::ssize(base_range);
+        return std::size_t((n + stride - 1) / stride);
+    }
+};
+
+template <typename R>
+struct sub_range
+{
+    R base_range;
+    gsl::index first;
+    gsl::index last;  // may be `unbounded_index`
+
+    using iterator = view_base_iterator_t<R>;
+
+    [[nodiscard]] constexpr iterator
+    begin(void) const
+    {
+        auto it = detail::range_begin(base_range);
+        detail::advance_bounded(it, first, iterator(detail::range_end(base_range)));
+        return it;
+    }
+    [[nodiscard]] constexpr iterator
+    end(void) const
+    {
+        if (last == unbounded_index) return detail::range_end(base_range);
+        auto it = detail::range_begin(base_range);
+        detail::advance_bounded(it, last, iterator(detail::range_end(base_range)));
+        return it;
+    }
+    template <typename R2 = R, typename = decltype(gsl::size(std::declval<R2 const&>()))>
+    [[nodiscard]] constexpr std::size_t
+    size(void) const
+    {
+        gsl::dim n = gsl::ssize(base_range);
+        gsl::index lo = first < n ? first : n;
+        gsl::index hi = last < n ? last : n;
+        return std::size_t(hi - lo);
+    }
+};
+
+
+    // Adjacent stages of the same kind are fused if the inner view is an rvalue.
+
+template <typename R, typename F>
+constexpr transform_range<R, F>
+make_transform_range(R&& range, F func)
+{
+    detail::check_common_range<std::remove_reference_t<R>>();
+    return { std::forward<R>(range), std::move(func) };
+}
+template <typename R, typename F0, typename F>
+constexpr transform_range<R, composed_function<F0, F>>
+make_transform_range(transform_range<R, F0>&& inner, F func)
+{
+    return { std::forward<R>(inner.base_range), { std::move(inner.func), std::move(func) } };
+}
+
+template <typename R, typename P>
+constexpr filter_range<R, P>
+make_filter_range(R&& range, P pred)
+{
+    detail::check_common_range<std::remove_reference_t<R>>();
+    return { std::forward<R>(range), std::move(pred) };
+}
+template <typename R, typename P0, typename P>
+constexpr filter_range<R, conjoined_predicate<P0, P>>
+make_filter_range(filter_range<R, P0>&& inner, P pred)
+{
+    return { std::forward<R>(inner.base_range), { std::move(inner.pred), std::move(pred) } };
+}
+
+template <typename R>
+constexpr stride_range<R>
+make_stride_range(R&& range, gsl::diff stride)
+{
+    detail::check_common_range<std::remove_reference_t<R>>();
+    return { std::forward<R>(range), stride };
+}
+template <typename R>
+constexpr stride_range<R>
+make_stride_range(stride_range<R>&& inner, gsl::diff stride)
+{
+    return { std::forward<R>(inner.base_range), inner.stride*stride };
+}
+
+template <typename R>
+constexpr sub_range<R>
+make_sub_range(R&& range, gsl::index first, gsl::index last)
+{
+    detail::check_common_range<std::remove_reference_t<R>>();
+    return { std::forward<R>(range), first, last };
+}
+template <typename R>
+constexpr sub_range<R>
+make_sub_range(sub_range<R>&& inner, gsl::index first, gsl::index last)
+{
+    return {
+        std::forward<R>(inner.base_range),
+        detail::clamped_offset(inner.first, first, inner.last),
+        detail::clamped_offset(inner.first, last, inner.last)
+    };
+}
+constexpr index_range
+make_sub_range(index_range range, gsl::index first, gsl::index last)
+{
+    gsl::index rfirst = *range.begin();
+    gsl::index rlast = *range.end();
+    return index_range(detail::clamped_offset(rfirst, first, rlast), detail::clamped_offset(rfirst, last, rlast));
+}
+
+
+} // namespace detail
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_DETAIL_VIEWS_HPP_
@@ -3,6 +3,8 @@
 #define INCLUDED_MAKESHIFT_EXPERIMENTAL_FUNCTIONAL_HPP_
 
 
+#include <array>
+#include <cstddef>      // for size_t, byte
 #include <utility>      // for move(), forward<>()
 #include <type_traits>  // for move(), forward<>()
 
@@ -12,6 +14,8 @@
 # error makeshift requires C++17 mode or higher
 #endif // !gsl_CPP17_OR_GREATER
 
+#include <makeshift/metadata.hpp>  // for reflector
+
 #include <makeshift/experimental/detail/functional.hpp>
 
 
@@ -116,6 +120,114 @@ constexpr lvalue_const_ref_fn<F> make_lvalue_const_ref_fn(F func)
 }
 
 
+
+    //
+    // Hash function object for types with reflected members which can be used with unordered associative containers.
+    //ᅟ
+    //ᅟ    struct Key { std::int32_t i, j; };
+    //ᅟ    constexpr auto reflect(gsl::type_identity<Key>) { return value_tuple{ &Key::i, &Key::j }; }
+    //ᅟ
+    //ᅟ    auto cache = std::unordered_map<Key, double, reflected_hash<Key>>{ };
+    //
+    // If all members are reflected and the object representation of `T` determines its value, i.e. if `T` has no padding bytes and
+    // no floating-point members, the object representation is hashed in a single pass. Otherwise, the hashes of the members
+    // given by `metadata::members<T>()` are combined. Enums are hashed through their underlying type, and strings, ranges and
+    // `std::optional<>` are hashed by value. Other types without reflected members are hashed with `std::hash<>`.
+    //
+    // The hash function is fast but not suitable for cryptographic purposes. Hash values depend on the byte order of the host
+    // and should not be persisted.
+    //
+template <typename T, typename ReflectorT = reflector>
+struct reflected_hash
+{
+        //
+        // Indicates whether the object representation of `T` is hashed directly.
+        //
+    static constexpr bool is_trivially_hashable = detail::is_bitwise_comparable<T, ReflectorT>();
+
+    [[nodiscard]] std::size_t
+    operator ()(T const& value) const
+    {
+        return std::size_t(detail::reflected_hash_value<ReflectorT>(value));
+    }
+};
+
+
+    //
+    // Equality function object for types with reflected members which compares the members given by `metadata::members<T>()`.
+    //ᅟ
+    //ᅟ    auto cache = std::unordered_map<Key, double, reflected_hash<Key>, reflected_equal<Key>>{ };
+    //
+    // If all members are reflected and the object representation of `T` determines its value, i.e. if `T` has no padding bytes and
+    // no floating-point members, objects are compared with a single `memcmp()`. Otherwise, members are compared one by one.
+    // Strings, ranges and `std::optional<>` are compared by value. Other types without reflected members are compared with
+    // `operator ==()`.
+    //
+template <typename T, typename ReflectorT = reflector>
+struct reflected_equal
+{
+        //
+        // Indicates whether objects are compared through their object representation.
+        //
+    static constexpr bool is_bitwise_comparable = detail::is_bitwise_comparable<T, ReflectorT>();
+
+    [[nodiscard]] bool
+    operator ()(T const& lhs, T const& rhs) const
+    {
+        return detail::reflected_equal_values<ReflectorT>(lhs, rhs);
+    }
+};
+
+
+    //
+    // Ordering function object for types with reflected members which compares the members given by `metadata::members<T>()`
+    // lexicographically.
+    //ᅟ
+    //ᅟ    std::sort(keys.begin(), keys.end(), reflected_less<Key>{ });
+    //
+    // Strings, ranges and `std::optional<>` are compared by value. Other types without reflected members are compared with
+    // `operator <()`.
+    //
+template <typename T, typename ReflectorT = reflector>
+struct reflected_less
+{
+    [[nodiscard]] bool
+    operator ()(T const& lhs, T const& rhs) const
+    {
+        return detail::reflected_less_values<ReflectorT>(lhs, rhs);
+    }
+};
+
+
+    //
+    // Returns the size of the sort key of a value of type `T` as returned by `make_sort_key()`.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] constexpr std::size_t
+sort_key_size(ReflectorT = { }) noexcept
+{
+    return detail::sort_key_size<T, ReflectorT>();
+}
+
+    //
+    // Returns a byte string which is ordered lexicographically like `value` is ordered by `reflected_less<T>`, which permits
+    // sorting with radix sort or comparing with `memcmp()`.
+    //ᅟ
+    //ᅟ    auto key = make_sort_key(Key{ -1, 2 });  // std::array<std::byte, 8>
+    //
+    // `T` must be an arithmetic type, an enum, an array of such types, or a class with reflected members of such types.
+    // Floating-point values are ordered by their IEEE 754 total order, which differs from `operator <()` in that negative zero
+    // precedes positive zero, and in that NaN values are ordered.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] std::array<std::byte, detail::sort_key_size<T, ReflectorT>()>
+make_sort_key(T const& value, ReflectorT = { }) noexcept
+{
+    auto result = std::array<std::byte, detail::sort_key_size<T, ReflectorT>()>{ };
+    detail::write_sort_key<ReflectorT>(result.data(), value);
+    return result;
+}
+
 } // namespace makeshift
 
 
@@ -0,0 +1,161 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_JSON_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_JSON_HPP_
+
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <string_view>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/metadata.hpp>  // for reflector
+
+#include <makeshift/experimental/detail/json.hpp>
+
+
+namespace makeshift {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Appends the JSON encoding of `value` to `sink`, which can be a `std::string`, a `std::vector<char>`, or a `std::ostream`.
+    //ᅟ
+    //ᅟ    enum class Color { red, green };
+    //ᅟ    constexpr auto reflect(gsl::type_identity<Color>)
+    //ᅟ    {
+    //ᅟ        return std::array{ std::pair{ Color::red, "red" }, std::pair{ Color::green, "green" } };
+    //ᅟ    }
+    //ᅟ
+    //ᅟ    struct Pixel { int x, y; Color color; };
+    //ᅟ    constexpr auto reflect(gsl::type_identity<Pixel>)
+    //ᅟ    {
+    //ᅟ        return value_tuple{ value_tuple{ &Pixel::x, "x" }, value_tuple{ &Pixel::y, "y" }, value_tuple{ &Pixel::color, "color" } };
+    //ᅟ    }
+    //ᅟ
+    //ᅟ    auto json = std::string{ };
+    //ᅟ    to_json(json, Pixel{ 1, 2, Color::green });  // appends {"x":1,"y":2,"color":"green"}
+    //
+    // Class types are encoded as objects with the members given by `metadata::members<T>()`, starting with the members of base
+    // classes. The member keys are quoted and escaped at compile time. Enums with value metadata are encoded as strings; enums of
+    // bitmask type are encoded as '+'-delimited lists of flags as with `flags_to_string()`. Strings, `std::optional<>`, ranges,
+    // `bool` and arithmetic types are encoded as JSON strings, values or `null`, arrays, literals and numbers, respectively.
+    // Non-finite floating-point values are encoded as `null`. Character arrays `char[N]` are encoded as strings which end at the
+    // first NUL character or after `N` characters.
+    //
+    // The encoding is written directly to `sink` without building a document tree, and no memory is allocated other than by
+    // `sink`.
+    //
+template <typename T, typename ReflectorT = reflector>
+void
+to_json(std::string& sink, T const& value, ReflectorT = { })
+{
+    detail::write_json<ReflectorT>(sink, value);
+}
+template <typename T, typename ReflectorT = reflector>
+void
+to_json(std::vector<char>& sink, T const& value, ReflectorT = { })
+{
+    detail::write_json<ReflectorT>(sink, value);
+}
+template <typename T, typename ReflectorT = reflector>
+void
+to_json(std::ostream& sink, T const& value, ReflectorT = { })
+{
+    detail::write_json<ReflectorT>(sink, value);
+}
+
+    //
+    // Returns the JSON encoding of `value` as a string.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] std::string
+to_json_string(T const& value, ReflectorT = { })
+{
+    auto result = std::string{ };
+    makeshift::to_json(result, value, ReflectorT{ });
+    return result;
+}
+
+
+    //
+    // Parses the JSON text `json` and stores the result in `value`. Throws `std::runtime_error` if `json` is malformed or does not
+    // match the type of `value`.
+    //ᅟ
+    //ᅟ    auto pixel = Pixel{ };
+    //ᅟ    from_json(pixel, R"({ "color": "red", "x": 3, "y": 4 })");
+    //
+    // Values are encoded as by `to_json()`. Members of objects may appear in any order, and missing members retain their
+    // previous value. Unknown members are skipped. The input is parsed in a single pass and stored directly in the members of
+    // `value`. Member names are looked up in a perfect hash table which is computed at compile time. Strings read into character
+    // arrays `char[N]` must not exceed `N` characters and are padded with NUL characters. Objects and arrays may be nested at
+    // most 512 levels deep, including unknown members.
+    //
+template <typename T, typename ReflectorT = reflector>
+void
+from_json(T& value, std::string_view json, ReflectorT = { })
+{
+    auto reader = detail::json_reader(json);
+    detail::read_json<ReflectorT>(reader, value);
+    reader.expect_end();
+}
+
+    //
+    // Parses the JSON text `json` and returns the result. `T` must be default-constructible. Throws `std::runtime_error` if `json`
+    // is malformed or does not match the type `T`.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] T
+from_json(std::string_view json, ReflectorT = { })
+{
+    T result{ };
+    makeshift::from_json(result, json, ReflectorT{ });
+    return result;
+}
+
+
+    //
+    // Parses the lines of `text` as key-value pairs and assigns the values to the corresponding members of `value`. Throws
+    // `std::runtime_error` if a line is malformed, if a key does not name a member, or if a value cannot be parsed.
+    //ᅟ
+    //ᅟ    auto pixel = Pixel{ };
+    //ᅟ    from_kv(pixel, "x = 3\n"
+    //ᅟ                   "color = green\n");
+    //
+    // Every line has the form `key = value`. Empty lines and lines starting with '#' are ignored. Members of nested objects are
+    // denoted by dotted keys such as `position.x`. Values are given without quotes; enumerators and flags are given by name as
+    // for `parse_enum()` and `parse_flags()`, and ranges are given as comma-separated lists. An empty value resets a
+    // `std::optional<>` member. Member names are looked up in a perfect hash table which is computed at compile time.
+    //
+template <typename T, typename ReflectorT = reflector>
+void
+from_kv(T& value, std::string_view text, ReflectorT = { })
+{
+    detail::read_kv<ReflectorT>(value, text);
+}
+
+    //
+    // Parses the lines of `text` as key-value pairs and returns an object whose members have been assigned the corresponding
+    // values. `T` must be default-constructible.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] T
+from_kv(std::string_view text, ReflectorT = { })
+{
+    T result{ };
+    makeshift::from_kv(result, text, ReflectorT{ });
+    return result;
+}
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_JSON_HPP_
@@ -0,0 +1,264 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_MEMORY_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_MEMORY_HPP_
+
+
+#include <new>          // for align_val_t, bad_array_new_length, operator new(), operator delete()
+#include <memory>       // for align()
+#include <cstddef>      // for size_t, byte, max_align_t
+#include <algorithm>    // for max()
+#include <type_traits>  // for true_type
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/experimental/detail/memory.hpp>
+
+
+namespace makeshift {
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Monotonic memory arena. Allocation bumps a pointer into the current memory block; memory is never released individually
+    // but only by `reset()` or `release()`, or when the arena is destroyed.
+    //ᅟ
+    // When the current block is exhausted, a new block is obtained with `operator new()`; block sizes grow geometrically.
+    // `reset()` retains the largest block, so an arena that is reset in every iteration of a loop stops allocating once it has
+    // grown large enough.
+    //ᅟ
+    //ᅟ    auto arena = monotonic_arena();
+    //ᅟ    for (...)
+    //ᅟ    {
+    //ᅟ        auto buf = make_buffer<double>(n, arena_allocator<double>(arena));
+    //ᅟ        ...
+    //ᅟ        arena.reset();
+    //ᅟ    }
+    //
+class monotonic_arena
+{
+private:
+    detail::arena_block* blocks_;  // most recently allocated (and hence largest) block first
+    std::byte* initialBuffer_;
+    std::size_t initialBufferSize_;
+    std::byte* cur_;
+    std::byte* end_;
+    std::size_t nextBlockSize_;
+
+    [[nodiscard]] void* _try_allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        void* ptr = cur_;
+        std::size_t space = std::size_t(end_ - cur_);
+        if (ptr == nullptr || std::align(alignment, size, ptr, space) == nullptr) return nullptr;
+        cur_ = static_cast<std::byte*>(ptr) + size;
+        return ptr;
+    }
+    [[nodiscard]] void* _allocate_from_new_block(std::size_t size, std::size_t alignment)
+    {
+        std::size_t blockSize = std::max(nextBlockSize_, size + alignment - 1);
+        blocks_ = detail::allocate_arena_block(blockSize, blocks_);
+        nextBlockSize_ = 2*blockSize;
+        cur_ = blocks_->payload();
+        end_ = cur_ + blockSize;
+        return _try_allocate(size, alignment);
+    }
+
+public:
+        //
+        // Constructs an arena which allocates its first block with the given size upon first use.
+        //
+    explicit monotonic_arena(std::size_t initialBlockSize = 4096) noexcept
+        : blocks_(nullptr), initialBuffer_(nullptr), initialBufferSize_(0), cur_(nullptr), end_(nullptr), nextBlockSize_(initialBlockSize)
+    {
+        gsl_Expects(initialBlockSize > 0);
+    }
+
+        //
+        // Constructs an arena which allocates from the given buffer before it resorts to heap allocation.
+        //
+    monotonic_arena(void* buffer, std::size_t size) noexcept
+        : blocks_(nullptr), initialBuffer_(static_cast<std::byte*>(buffer)), initialBufferSize_(size),
+          cur_(initialBuffer_), end_(initialBuffer_ + size), nextBlockSize_(std::max(std::size_t(2*size), std::size_t(64)))
+    {
+        gsl_Expects(buffer != nullptr || size == 0);
+    }
+
+    monotonic_arena(monotonic_arena const&) = delete;
+    monotonic_arena& operator =(monotonic_arena const&) = delete;
+
+    ~monotonic_arena()
+    {
+        detail::free_arena_blocks(blocks_);
+    }
+
+        //
+        // Allocates `size` bytes aligned to `alignment`, which must be a power of 2.
+        //
+    [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        gsl_Expects(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+        if (void* ptr = _try_allocate(size, alignment)) return ptr;
+        return _allocate_from_new_block(size, alignment);
+    }
+
+        //
+        // Makes all memory available for allocation again. Retains the largest memory block and releases all other blocks.
+        //
+    void reset(void) noexcept
+    {
+        if (blocks_ != nullptr)
+        {
+            detail::free_arena_blocks(blocks_->next);
+            blocks_->next = nullptr;
+            cur_ = blocks_->payload();
+            end_ = cur_ + blocks_->size;
+        }
+        else
+        {
+            cur_ = initialBuffer_;
+            end_ = initialBuffer_ + initialBufferSize_;
+        }
+    }
+
+        //
+        // Makes all memory available for allocation again and releases all memory blocks.
+        //
+    void release(void) noexcept
+    {
+        detail::free_arena_blocks(blocks_);
+        blocks_ = nullptr;
+        cur_ = initialBuffer_;
+        end_ = initialBuffer_ + initialBufferSize_;
+    }
+};
+
+
+    //
+    // Allocator which obtains memory from a `monotonic_arena`. Deallocation is a no-op.
+    //ᅟ
+    //ᅟ    auto arena = monotonic_arena();
+    //ᅟ    auto v = std::vector<int, arena_allocator<int>>(arena_allocator<int>(arena));
+    //
+template <typename T>
+class arena_allocator
+{
+    template <typename U> friend class arena_allocator;
+
+private:
+    monotonic_arena* arena_;
+
+public:
+    using value_type = T;
+
+    explicit arena_allocator(monotonic_arena& arena) noexcept
+        : arena_(&arena)
+    {
+    }
+    template <typename U>
+    arena_allocator(arena_allocator<U> const& rhs) noexcept
+        : arena_(rhs.arena_)
+    {
+    }
+
+    [[nodiscard]] monotonic_arena& arena(void) const noexcept
+    {
+        return *arena_;
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if (n > std::size_t(-1)/sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+    }
+    void deallocate(T* /*ptr*/, std::size_t /*n*/) noexcept
+    {
+    }
+
+    template <typename U>
+    [[nodiscard]] friend bool operator ==(arena_allocator const& lhs, arena_allocator<U> const& rhs) noexcept
+    {
+        return &lhs.arena() == &rhs.arena();
+    }
+    template <typename U>
+    [[nodiscard]] friend bool operator !=(arena_allocator const& lhs, arena_allocator<U> const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+
+    //
+    // Stateless allocator which recycles memory blocks through thread-local free lists. Requests are rounded up to power-of-2
+    // size classes between 16 and 4096 bytes; every thread caches up to 64 released blocks per size class. Larger or over-aligned
+    // requests are forwarded to `operator new()`.
+    //ᅟ
+    // Memory may be deallocated on a different thread than the one that allocated it.
+    //ᅟ
+    //ᅟ    for (...)
+    //ᅟ    {
+    //ᅟ        auto buf = make_buffer<double>(n, pool_allocator<double>{ });  // reuses the block released in the previous iteration
+    //ᅟ        ...
+    //ᅟ    }
+    //
+template <typename T>
+class pool_allocator
+{
+private:
+    static constexpr bool isOverAligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    constexpr pool_allocator(void) noexcept = default;
+    template <typename U>
+    constexpr pool_allocator(pool_allocator<U> const&) noexcept
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if (n > std::size_t(-1)/sizeof(T)) throw std::bad_array_new_length();
+        if constexpr (isOverAligned)
+        {
+            return static_cast<T*>(::operator new(n*sizeof(T), std::align_val_t(alignof(T))));
+        }
+        else
+        {
+            return static_cast<T*>(detail::pool_allocate(n*sizeof(T)));
+        }
+    }
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if constexpr (isOverAligned)
+        {
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+        }
+        else
+        {
+            detail::pool_deallocate(ptr, n*sizeof(T));
+        }
+    }
+
+    template <typename U>
+    [[nodiscard]] friend constexpr bool operator ==(pool_allocator const&, pool_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+    template <typename U>
+    [[nodiscard]] friend constexpr bool operator !=(pool_allocator const&, pool_allocator<U> const&) noexcept
+    {
+        return false;
+    }
+};
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_MEMORY_HPP_
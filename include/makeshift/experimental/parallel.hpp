@@ -0,0 +1,170 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_PARALLEL_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_PARALLEL_HPP_
+
+
+    //
+    // The functions in this header run work on a process-wide thread pool. Programs using them must be linked with the
+    // platform's threading library (e.g. `Threads::Threads` in CMake).
+    //
+
+
+#include <tuple>
+#include <vector>
+#include <cstddef>  // for size_t
+#include <utility>  // for forward<>()
+
+#include <gsl-lite/gsl-lite.hpp>  // for index, gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/metadata.hpp>  // for reflector
+
+#include <makeshift/detail/tuple-transform.hpp>  // for are_tuple_args<>, tuple_transform_size<>()
+
+#include <makeshift/experimental/detail/parallel.hpp>
+#include <makeshift/experimental/detail/algorithm.hpp>  // for sort_permutation_by_members<>(), gather_permutation()
+
+
+namespace makeshift {
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Takes a scalar procedure (i.e. a function of non-tuple arguments which returns nothing) and calls the procedure for every
+    // element in the given tuples, like `template_for()`. The calls are executed concurrently on a work-stealing thread pool,
+    // and the function returns once all calls have completed. If any of the calls throws an exception, the exception thrown
+    // by the call for the lowest element index is rethrown.
+    //ᅟ
+    //ᅟ    template_for_parallel(
+    //ᅟ        [](auto& solver) { solver.solve(); },
+    //ᅟ        subSolvers);
+    //
+    // The procedure must be safe to call concurrently for different elements.
+    //
+template <typename F, typename... Ts>
+void
+template_for_parallel(F&& func, Ts&&... args)
+{
+    static_assert(detail::are_tuple_args_v<Ts...>, "arguments must be tuples or tuple-like types");
+    constexpr std::size_t size = detail::tuple_transform_size<-1, Ts...>();
+    if constexpr (size != 0)
+    {
+        auto job = detail::template_for_parallel_job<size, F, Ts...>(func, std::forward<Ts>(args)...);
+        job.execute();
+    }
+}
+
+
+    //
+    // Takes a scalar procedure (i.e. a function of non-tuple arguments which returns nothing) and calls the procedure for every
+    // element in the given tuples, like `template_for<N>()`. The calls are executed concurrently on a work-stealing thread pool.
+    //ᅟ
+    //ᅟ    template_for_parallel<3>(
+    //ᅟ        [&](auto idxC) { std::get<idxC()>(results) = compute<idxC()>(); },
+    //ᅟ        tuple_index);
+    //
+template <std::size_t N, typename F, typename... Ts>
+void
+template_for_parallel(F&& func, Ts&&... args)
+{
+    static_assert(detail::are_tuple_args_v<Ts...>, "arguments must be tuples or tuple-like types");
+    constexpr std::size_t size = detail::tuple_transform_size<N, Ts...>();
+    if constexpr (size != 0)
+    {
+        auto job = detail::template_for_parallel_job<size, F, Ts...>(func, std::forward<Ts>(args)...);
+        job.execute();
+    }
+}
+
+
+    //
+    // Takes a scalar function (i.e. a function of non-tuple arguments) and returns a tuple of the results of the function applied
+    // to the tuple elements, like `tuple_transform()`. The function calls are executed concurrently on a work-stealing thread
+    // pool; the results are returned in element order. If any of the calls throws an exception, the exception thrown by the
+    // call for the lowest element index is rethrown.
+    //ᅟ
+    //ᅟ    auto residuals = tuple_transform_parallel(
+    //ᅟ        [](auto& solver) { return solver.solve(); },
+    //ᅟ        subSolvers);
+    //
+template <typename F, typename... Ts>
+[[nodiscard]] auto
+tuple_transform_parallel(F&& func, Ts&&... args)
+{
+    static_assert(detail::are_tuple_args_v<Ts...>, "arguments must be tuples or tuple-like types");
+    constexpr std::size_t size = detail::tuple_transform_size<-1, Ts...>();
+    if constexpr (size == 0)
+    {
+        return std::tuple<>{ };
+    }
+    else
+    {
+        auto job = detail::tuple_transform_parallel_job<size, F, Ts...>(func, std::forward<Ts>(args)...);
+        job.execute();
+        return job.take_results();
+    }
+}
+
+
+    //
+    // Takes a scalar function (i.e. a function of non-tuple arguments) and returns a tuple of the results of the function applied
+    // to the tuple elements, like `tuple_transform<N>()`. The function calls are executed concurrently on a work-stealing thread
+    // pool; the results are returned in element order.
+    //ᅟ
+    //ᅟ    auto squares = tuple_transform_parallel<3>(
+    //ᅟ        [](gsl::index i) { return i*i; },
+    //ᅟ        range_index);
+    //ᅟ    // returns std::tuple{ 0, 1, 4 }
+    //
+template <std::size_t N, typename F, typename... Ts>
+[[nodiscard]] auto
+tuple_transform_parallel(F&& func, Ts&&... args)
+{
+    static_assert(detail::are_tuple_args_v<Ts...>, "arguments must be tuples or tuple-like types");
+    constexpr std::size_t size = detail::tuple_transform_size<N, Ts...>();
+    if constexpr (size == 0)
+    {
+        return std::tuple<>{ };
+    }
+    else
+    {
+        auto job = detail::tuple_transform_parallel_job<size, F, Ts...>(func, std::forward<Ts>(args)...);
+        job.execute();
+        return job.take_results();
+    }
+}
+
+
+    //
+    // Returns the permutation which stably sorts the records in the range [first, last) by the members given by the constval
+    // `membersC`, like `sort_permutation_by_members()`. For large ranges, the radix sort passes are executed concurrently on the
+    // thread pool of `template_for_parallel()`.
+    //
+template <typename RandomIt, typename MembersC, typename ReflectorT = reflector>
+[[nodiscard]] std::vector<gsl::index>
+sort_permutation_by_members_parallel(RandomIt first, RandomIt last, MembersC membersC, ReflectorT = { })
+{
+    return detail::sort_permutation_by_members<detail::parallel_chunk_executor, ReflectorT>(first, last, membersC);
+}
+
+    //
+    // Stably sorts the records in the range [first, last) by the members given by the constval `membersC`, like
+    // `sort_by_members()`, but determines the permutation with `sort_permutation_by_members_parallel()`.
+    //
+template <typename RandomIt, typename MembersC, typename ReflectorT = reflector>
+void
+sort_by_members_parallel(RandomIt first, RandomIt last, MembersC membersC, ReflectorT = { })
+{
+    auto permutation = detail::sort_permutation_by_members<detail::parallel_chunk_executor, ReflectorT>(first, last, membersC);
+    detail::gather_permutation(first, last, permutation);
+}
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_PARALLEL_HPP_
@@ -0,0 +1,306 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_SERIALIZE_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_SERIALIZE_HPP_
+
+
+#include <tuple>        // for tuple_size<>
+#include <cstddef>      // for size_t, ptrdiff_t, byte
+#include <utility>      // for make_index_sequence<>
+#include <cstdint>      // for uintptr_t
+#include <stdexcept>    // for runtime_error
+#include <type_traits>  // for conditional<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for span<>, gsl_Expects(), gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/metadata.hpp>  // for reflector, metadata::find_member_by_name<>(), metadata::find_member_index_by_name<>()
+
+#include <makeshift/experimental/detail/serialize.hpp>
+
+
+namespace makeshift {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Returns the number of bytes in the binary encoding of a value of type `T`.
+    //
+    // Arithmetic types and enums are encoded with their size in little-endian byte order, and `bool` is encoded as a single byte.
+    // Arrays and `std::array<>` are encoded element by element. Other types must have reflected members, which are encoded in the
+    // order given by `metadata::members<T>()`, starting with the members of base classes.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] constexpr std::size_t
+binary_size(ReflectorT = { }) noexcept
+{
+    return detail::binary_size<T, ReflectorT>();
+}
+
+
+    //
+    // Writes the binary encoding of `value` to the beginning of `buffer`, which must hold at least `binary_size<T>()` bytes. Returns
+    // the number of bytes written.
+    //ᅟ
+    //ᅟ    struct Point { float x, y; std::int32_t id; };
+    //ᅟ    constexpr auto reflect(gsl::type_identity<Point>) { return value_tuple{ &Point::x, &Point::y, &Point::id }; }
+    //ᅟ
+    //ᅟ    auto bytes = std::vector<std::byte>(points.size()*binary_size<Point>());
+    //ᅟ    auto pos = gsl::span<std::byte>(bytes);
+    //ᅟ    for (Point const& p : points)
+    //ᅟ    {
+    //ᅟ        pos = pos.subspan(serialize_binary(p, pos));
+    //ᅟ    }
+    //
+    // The encoding has a fixed layout in which scalars are stored in little-endian byte order. The layout is independent of the
+    // host only if all scalars have fixed-width types such as `std::int32_t` or `float`; the sizes of types such as `long` or
+    // `wchar_t` vary between platforms. `long double` is not supported. Adjacent members whose in-memory representation
+    // coincides with their encoding are copied with a single `memcpy()`. No memory is allocated.
+    //
+template <typename T, typename ReflectorT = reflector>
+std::size_t
+serialize_binary(T const& value, gsl::span<std::byte> buffer, ReflectorT = { })
+{
+    constexpr std::size_t size = detail::binary_size<T, ReflectorT>();
+    gsl_Expects(buffer.size() >= size);
+
+    detail::write_binary<ReflectorT>(buffer.data(), value);
+    return size;
+}
+
+
+    //
+    // Reads the binary encoding of a value of type `T` from the beginning of `buffer` and stores it in `value`. Returns the number
+    // of bytes read. Throws `std::runtime_error` if `buffer` holds less than `binary_size<T>()` bytes.
+    //
+template <typename T, typename ReflectorT = reflector>
+std::size_t
+deserialize_binary(T& value, gsl::span<std::byte const> buffer, ReflectorT = { })
+{
+    constexpr std::size_t size = detail::binary_size<T, ReflectorT>();
+    if (buffer.size() < size) throw std::runtime_error("unexpected end of binary data");
+
+    detail::read_binary<ReflectorT>(buffer.data(), value);
+    return size;
+}
+
+    //
+    // Reads the binary encoding of a value of type `T` from the beginning of `buffer` and returns the value. `T` must be
+    // default-constructible. Throws `std::runtime_error` if `buffer` holds less than `binary_size<T>()` bytes.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] T
+deserialize_binary(gsl::span<std::byte const> buffer, ReflectorT = { })
+{
+    T result{ };
+    makeshift::deserialize_binary(result, buffer, ReflectorT{ });
+    return result;
+}
+
+
+    //
+    // Read-only view of an array of records of type `T` stored in the binary encoding of `serialize_binary()`, e.g. in a
+    // memory-mapped file.
+    //ᅟ
+    //ᅟ    auto records = record_view<COO>(gsl::span<std::byte const>(mappedData, mappedSize));
+    //ᅟ    double sum = 0;
+    //ᅟ    for (gsl::index k = 0; k != records.ssize(); ++k)
+    //ᅟ    {
+    //ᅟ        sum += records.member(k, MAKESHIFT_CONSTVAL(std::string_view("v")));
+    //ᅟ    }
+    //
+    // If the object representation of `T` is identical to its encoding, which is checked at compile time, records are accessed
+    // in-place without copying, and `operator []()` and `member()` return references into the underlying memory. The underlying
+    // memory must then be suitably aligned for `T`. Otherwise, records and members are decoded on access and returned by value.
+    //
+template <typename T, typename ReflectorT = reflector>
+class record_view
+{
+private:
+    using Info_ = detail::members_binary_info<T, ReflectorT>;
+
+    std::byte const* data_;
+    std::size_t size_;
+
+public:
+        //
+        // Indicates whether records are accessed in-place.
+        //
+    static constexpr bool is_zero_copy = detail::is_binary_layout_compatible<T, ReflectorT>();
+
+    static constexpr std::size_t record_size = detail::binary_size<T, ReflectorT>();
+
+        //
+        // Constructs a view of the records in `bytes`. Throws `std::runtime_error` if the size of `bytes` is not a multiple of
+        // the record size.
+        //
+    explicit record_view(gsl::span<std::byte const> bytes)
+        : data_(bytes.data()), size_(bytes.size()/record_size)
+    {
+        if (bytes.size() % record_size != 0) throw std::runtime_error("binary data size is not a multiple of the record size");
+        if constexpr (is_zero_copy)
+        {
+            gsl_Expects(reinterpret_cast<std::uintptr_t>(data_) % alignof(T) == 0);
+        }
+    }
+
+    [[nodiscard]] std::size_t size(void) const noexcept
+    {
+        return size_;
+    }
+    [[nodiscard]] std::ptrdiff_t ssize(void) const noexcept
+    {
+        return std::ptrdiff_t(size_);
+    }
+    [[nodiscard]] bool empty(void) const noexcept
+    {
+        return size_ == 0;
+    }
+
+        //
+        // Returns the records as a span. Only available if records are accessed in-place.
+        //
+    [[nodiscard]] gsl::span<T const> records(void) const noexcept
+    {
+        static_assert(is_zero_copy, "records can be accessed in-place only if the object representation of T matches its binary encoding");
+
+        return { reinterpret_cast<T const*>(data_), size_ };
+    }
+
+        //
+        // Returns the record at index `i`, either as a reference into the underlying memory or as a decoded value.
+        //
+    [[nodiscard]] std::conditional_t<is_zero_copy, T const&, T>
+    operator [](std::size_t i) const
+    {
+        gsl_Expects(i < size_);
+
+        if constexpr (is_zero_copy)
+        {
+            return reinterpret_cast<T const*>(data_)[i];
+        }
+        else
+        {
+            T result{ };
+            detail::read_binary<ReflectorT>(data_ + i*record_size, result);
+            return result;
+        }
+    }
+
+        //
+        // Returns the member with the name given by the constval `nameC` of the record at index `i`, either as a reference into
+        // the underlying memory or as a decoded value. Only the requested member is decoded.
+        //
+    template <typename NameC>
+    [[nodiscard]] decltype(auto)
+    member(std::size_t i, NameC nameC) const
+    {
+        gsl_Expects(i < size_);
+
+        constexpr auto m = metadata::find_member_by_name<T, ReflectorT>(nameC);
+        if constexpr (is_zero_copy)
+        {
+            return (reinterpret_cast<T const*>(data_)[i].*m);
+        }
+        else
+        {
+            constexpr std::size_t index = std::size_t(metadata::find_member_index_by_name<T, ReflectorT>(nameC()));
+            detail::member_value_t<T, decltype(m)> result{ };
+            detail::read_binary<ReflectorT>(data_ + i*record_size + Info_::binary_offset(index), result);
+            return result;
+        }
+    }
+};
+
+
+    //
+    // Returns the number of bytes in the bitmask of changed members which every patch written by `diff_members()` begins with.
+    // A patch of this size carries no changes.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] constexpr std::size_t
+patch_mask_size(ReflectorT = { }) noexcept
+{
+    return detail::patch_mask_size<T, ReflectorT>();
+}
+
+    //
+    // Returns the maximal number of bytes in a patch written by `diff_members()` for type `T`.
+    //
+template <typename T, typename ReflectorT = reflector>
+[[nodiscard]] constexpr std::size_t
+max_patch_size(ReflectorT = { }) noexcept
+{
+    return detail::patch_mask_size<T, ReflectorT>() + detail::binary_size<T, ReflectorT>();
+}
+
+
+    //
+    // Writes a patch which transforms `oldValue` into `newValue` to the beginning of `buffer`, which must hold at least
+    // `max_patch_size<T>()` bytes. Returns the number of bytes written.
+    //ᅟ
+    //ᅟ    auto buffer = std::array<std::byte, max_patch_size<State>()>{ };
+    //ᅟ    std::size_t n = diff_members(sentState, state, buffer);
+    //ᅟ    if (n != patch_mask_size<State>())
+    //ᅟ    {
+    //ᅟ        send(gsl::span(buffer).first(n));
+    //ᅟ        sentState = state;
+    //ᅟ    }
+    //
+    // The patch begins with a bitmask of `patch_mask_size<T>()` bytes in which bit `i % 8` of byte `i / 8` is set if the member
+    // at index `i` of `metadata::members<T>()` has changed, followed by the binary encodings of the changed members as written
+    // by `serialize_binary()`. Members are compared by their encodings; nested classes are compared and transmitted as a whole.
+    //
+template <typename T, typename ReflectorT = reflector>
+std::size_t
+diff_members(T const& oldValue, T const& newValue, gsl::span<std::byte> buffer, ReflectorT = { })
+{
+    gsl_Expects(buffer.size() >= makeshift::max_patch_size<T>(ReflectorT{ }));
+
+    using Members = std::remove_const_t<std::remove_reference_t<decltype(metadata::members<T, ReflectorT>())>>;
+    std::byte* end = detail::write_patch<ReflectorT>(buffer.data(), oldValue, newValue, std::make_index_sequence<std::tuple_size<Members>::value>{ });
+    return std::size_t(end - buffer.data());
+}
+
+    //
+    // Applies the patch at the beginning of `patch`, as written by `diff_members()`, to `value`. Returns the number of bytes read.
+    // Only the changed members are decoded and assigned. Throws `std::runtime_error` if the bitmask refers to a member which does
+    // not exist or if `patch` ends prematurely, in which case `value` is left unchanged.
+    //
+template <typename T, typename ReflectorT = reflector>
+std::size_t
+apply_patch(T& value, gsl::span<std::byte const> patch, ReflectorT = { })
+{
+    using Info = detail::members_binary_info<T, ReflectorT>;
+    constexpr std::size_t maskSize = detail::patch_mask_size<T, ReflectorT>();
+    constexpr auto const& readers = detail::member_reader_table_v<T, ReflectorT>;
+
+    if (patch.size() < maskSize) throw std::runtime_error("unexpected end of binary data");
+    std::byte const* mask = patch.data();
+    std::size_t size = maskSize;
+    detail::for_each_patch_member(mask, maskSize,
+        [&size](std::size_t i)
+        {
+            if (i >= readers.size()) throw std::runtime_error("patch refers to non-existent member");
+            size += Info::binary_sizes[i];
+        });
+    if (patch.size() < size) throw std::runtime_error("unexpected end of binary data");
+
+    std::byte const* src = mask + maskSize;
+    detail::for_each_patch_member(mask, maskSize,
+        [&src, &value](std::size_t i)
+        {
+            src = readers[i](src, value);
+        });
+    return size;
+}
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_SERIALIZE_HPP_
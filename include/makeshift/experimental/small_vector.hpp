@@ -0,0 +1,375 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_SMALL_VECTOR_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_SMALL_VECTOR_HPP_
+
+
+#include <memory>            // for allocator<>, allocator_traits<>
+#include <cstddef>           // for size_t, ptrdiff_t, byte
+#include <utility>           // for move(), move_if_noexcept(), forward<>()
+#include <algorithm>         // for max(), equal()
+#include <type_traits>       // for is_nothrow_move_constructible<>
+#include <initializer_list>
+
+#include <gsl-lite/gsl-lite.hpp>  // for gsl_Expects(), gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/experimental/detail/buffer.hpp>  // for buffer_interface_mixin<>, dynamic_buffer_storage<>, allocate_storage<>(), deallocate_storage<>()
+
+
+namespace makeshift {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Resizable array-like container which stores up to `N` elements in-place and moves to heap storage obtained from `Allocator`
+    // when it grows beyond that. Heap storage grows geometrically.
+    //ᅟ
+    //ᅟ    auto neighbors = small_vector<gsl::index, 8>{ };
+    //ᅟ    for (...)
+    //ᅟ    {
+    //ᅟ        neighbors.push_back(j); // allocates only if there are more than 8 neighbors
+    //ᅟ    }
+    //
+    // Moving a `small_vector<>` steals the heap storage; elements stored in-place are moved individually.
+    //
+template <typename T, std::ptrdiff_t N, typename Allocator = std::allocator<T>>
+class small_vector : public detail::buffer_interface_mixin<T, small_vector<T, N, Allocator>>
+{
+    static_assert(N >= 0, "in-place capacity must be non-negative");
+
+private:
+    using Traits_ = std::allocator_traits<Allocator>;
+
+    detail::dynamic_buffer_storage<T, Allocator> storage_;
+    std::size_t capacity_;
+    alignas(T) std::byte buf_[N > 0 ? N*sizeof(T) : 1];
+
+    [[nodiscard]] T* _inline_data(void) noexcept
+    {
+        return reinterpret_cast<T*>(buf_);
+    }
+    [[nodiscard]] bool _on_heap(void) const noexcept
+    {
+        return storage_.data != reinterpret_cast<T const*>(buf_);
+    }
+    void _destroy_elements(void) noexcept
+    {
+        for (std::size_t i = storage_.size; i != 0; --i)
+        {
+            Traits_::destroy(storage_.allocator(), storage_.data + (i - 1));
+        }
+        storage_.size = 0;
+    }
+    void _release(void) noexcept
+    {
+        _destroy_elements();
+        if (_on_heap())
+            detail::deallocate_storage<T, alignof(T)>(storage_.allocator(), storage_.data, capacity_);
+        storage_.data = _inline_data();
+        capacity_ = N;
+    }
+        // Moves the elements to `dest`, constructing them with the allocator `destAlloc` of the vector which owns `dest`.
+    void _move_elements_to(T* dest, Allocator& destAlloc)
+    {
+        if constexpr (std::is_nothrow_move_constructible<T>::value)
+        {
+            for (std::size_t i = 0; i != storage_.size; ++i)
+            {
+                Traits_::construct(destAlloc, dest + i, std::move(storage_.data[i]));
+            }
+        }
+        else
+        {
+            std::size_t i = 0;
+            try
+            {
+                for (; i != storage_.size; ++i)
+                {
+                    Traits_::construct(destAlloc, dest + i, std::move_if_noexcept(storage_.data[i]));
+                }
+            }
+            catch (...)
+            {
+                for (; i != 0; --i)
+                {
+                    Traits_::destroy(destAlloc, dest + (i - 1));
+                }
+                throw;
+            }
+        }
+    }
+
+        // Moves the elements to new heap storage with the given capacity; `emplaceFunc` constructs an additional element at the end
+        // of the new storage before the existing elements are moved, which keeps references to existing elements valid until then.
+    template <typename EmplaceFuncT>
+    void _reallocate(std::size_t newCapacity, EmplaceFuncT&& emplaceFunc)
+    {
+        T* newData = detail::allocate_storage<T, alignof(T)>(storage_.allocator(), newCapacity);
+        std::size_t numEmplaced = 0;
+        try
+        {
+            numEmplaced = emplaceFunc(newData + storage_.size);
+            _move_elements_to(newData, storage_.allocator());
+        }
+        catch (...)
+        {
+            if (numEmplaced != 0)
+                Traits_::destroy(storage_.allocator(), newData + storage_.size);
+            detail::deallocate_storage<T, alignof(T)>(storage_.allocator(), newData, newCapacity);
+            throw;
+        }
+        std::size_t size = storage_.size;
+        _release();
+        storage_.data = newData;
+        storage_.size = size + numEmplaced;
+        capacity_ = newCapacity;
+    }
+    [[nodiscard]] std::size_t _grown_capacity(std::size_t minCapacity) const noexcept
+    {
+        return std::max(minCapacity, 2*capacity_);
+    }
+
+        // Takes over the elements of `rhs`, whose heap storage must be deallocatable with our allocator. Expects `*this` to be empty
+        // and to use in-place storage.
+    void _take(small_vector& rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (rhs._on_heap())
+        {
+            storage_.data = rhs.storage_.data;
+            storage_.size = rhs.storage_.size;
+            capacity_ = rhs.capacity_;
+            rhs.storage_.data = rhs._inline_data();
+            rhs.storage_.size = 0;
+            rhs.capacity_ = N;
+        }
+        else
+        {
+            rhs._move_elements_to(storage_.data, storage_.allocator());
+            storage_.size = rhs.storage_.size;
+            rhs._destroy_elements();
+        }
+    }
+    template <typename It>
+    void _append_copies(It first, std::size_t count)
+    {
+        reserve(storage_.size + count);
+        for (std::size_t i = 0; i != count; ++i, ++first)
+        {
+            Traits_::construct(storage_.allocator(), storage_.data + storage_.size, *first);
+            ++storage_.size;
+        }
+    }
+
+public:
+    using allocator_type = Allocator;
+
+    small_vector(void) noexcept(noexcept(Allocator()))
+        : small_vector(Allocator())
+    {
+    }
+    explicit small_vector(Allocator const& alloc) noexcept
+        : storage_(alloc, 0), capacity_(N)
+    {
+        storage_.data = _inline_data();
+    }
+    explicit small_vector(std::size_t count, Allocator const& alloc = Allocator())
+        : small_vector(alloc)
+    {
+        resize(count);
+    }
+    small_vector(std::size_t count, T const& value, Allocator const& alloc = Allocator())
+        : small_vector(alloc)
+    {
+        resize(count, value);
+    }
+    small_vector(std::initializer_list<T> values, Allocator const& alloc = Allocator())
+        : small_vector(alloc)
+    {
+        _append_copies(values.begin(), values.size());
+    }
+    small_vector(small_vector const& rhs, Allocator const& alloc)
+        : small_vector(alloc)
+    {
+        _append_copies(rhs.data(), rhs.size());
+    }
+    small_vector(small_vector const& rhs)
+        : small_vector(rhs, Traits_::select_on_container_copy_construction(rhs.get_allocator()))
+    {
+    }
+    small_vector(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : small_vector(rhs.storage_.allocator())
+    {
+        _take(rhs);
+    }
+    small_vector& operator =(small_vector const& rhs)
+    {
+        if (this != &rhs)
+        {
+            if constexpr (Traits_::propagate_on_container_copy_assignment::value)
+            {
+                if (storage_.allocator() != rhs.storage_.allocator())
+                    _release();
+                storage_.allocator() = rhs.storage_.allocator();
+            }
+            clear();
+            _append_copies(rhs.data(), rhs.size());
+        }
+        return *this;
+    }
+    small_vector& operator =(small_vector&& rhs)
+        noexcept((Traits_::propagate_on_container_move_assignment::value || Traits_::is_always_equal::value) && std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &rhs)
+        {
+            _release();
+            if constexpr (Traits_::propagate_on_container_move_assignment::value)
+            {
+                storage_.allocator() = std::move(rhs.storage_.allocator());
+                _take(rhs);
+            }
+            else if (storage_.allocator() == rhs.storage_.allocator())
+                _take(rhs);
+            else
+            {
+                reserve(rhs.size());
+                rhs._move_elements_to(storage_.data, storage_.allocator());
+                storage_.size = rhs.storage_.size;
+                rhs.clear();
+            }
+        }
+        return *this;
+    }
+    ~small_vector(void)
+    {
+        _release();
+    }
+
+    [[nodiscard]] Allocator get_allocator(void) const noexcept
+    {
+        return storage_.allocator();
+    }
+
+    [[nodiscard]] std::size_t size(void) const noexcept
+    {
+        return storage_.size;
+    }
+    [[nodiscard]] std::size_t capacity(void) const noexcept
+    {
+        return capacity_;
+    }
+    [[nodiscard]] static constexpr std::size_t inline_capacity(void) noexcept
+    {
+        return N;
+    }
+
+    [[nodiscard]] T* data(void) noexcept
+    {
+        return storage_.data;
+    }
+    [[nodiscard]] T const* data(void) const noexcept
+    {
+        return storage_.data;
+    }
+
+        //
+        // Ensures that the vector can hold `newCapacity` elements without reallocating.
+        //
+    void reserve(std::size_t newCapacity)
+    {
+        if (newCapacity > capacity_)
+            _reallocate(newCapacity, [](T*) { return std::size_t(0); });
+    }
+
+    void resize(std::size_t newSize)
+    {
+        if (newSize < storage_.size)
+        {
+            while (storage_.size != newSize) pop_back();
+        }
+        else
+        {
+            if (newSize > capacity_)
+                reserve(_grown_capacity(newSize));
+            while (storage_.size != newSize) emplace_back();
+        }
+    }
+    void resize(std::size_t newSize, T const& value)
+    {
+        if (newSize < storage_.size)
+        {
+            while (storage_.size != newSize) pop_back();
+        }
+        else
+        {
+            if (newSize > capacity_)
+            {
+                    // `value` might refer to an element of the vector.
+                T valueCopy = value;
+                reserve(_grown_capacity(newSize));
+                while (storage_.size != newSize) emplace_back(valueCopy);
+            }
+            else
+            {
+                while (storage_.size != newSize) emplace_back(value);
+            }
+        }
+    }
+
+    template <typename... ArgsT>
+    T& emplace_back(ArgsT&&... args)
+    {
+        if (storage_.size == capacity_)
+        {
+            _reallocate(_grown_capacity(storage_.size + 1),
+                [&](T* ptr)
+                {
+                    Traits_::construct(storage_.allocator(), ptr, std::forward<ArgsT>(args)...);
+                    return std::size_t(1);
+                });
+        }
+        else
+        {
+            Traits_::construct(storage_.allocator(), storage_.data + storage_.size, std::forward<ArgsT>(args)...);
+            ++storage_.size;
+        }
+        return storage_.data[storage_.size - 1];
+    }
+    void push_back(T const& value)
+    {
+        emplace_back(value);
+    }
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+    void pop_back(void)
+    {
+        gsl_Expects(storage_.size != 0);
+        --storage_.size;
+        Traits_::destroy(storage_.allocator(), storage_.data + storage_.size);
+    }
+    void clear(void) noexcept
+    {
+        _destroy_elements();
+    }
+
+    [[nodiscard]] friend bool operator ==(small_vector const& lhs, small_vector const& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+    [[nodiscard]] friend bool operator !=(small_vector const& lhs, small_vector const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_SMALL_VECTOR_HPP_
@@ -0,0 +1,725 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_SOA_VECTOR_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_SOA_VECTOR_HPP_
+
+
+#include <tuple>
+#include <memory>           // for allocator<>, allocator_traits<>
+#include <cstddef>          // for size_t, ptrdiff_t, byte
+#include <utility>          // for move(), move_if_noexcept(), forward<>(), exchange(), as_const()
+#include <algorithm>        // for max(), equal()
+#include <type_traits>      // for is_const<>, is_reference<>, is_same<>, conjunction<>, disjunction<>, negation<>
+#include <memory_resource>  // for pmr::polymorphic_allocator<>
+
+#include <gsl-lite/gsl-lite.hpp>  // for span<>, gsl_Expects(), gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/tuple.hpp>        // for template_for()
+#include <makeshift/metadata.hpp>     // for reflector, metadata::members<>()
+#include <makeshift/type_traits.hpp>  // for nth_type<>
+
+#include <makeshift/experimental/span.hpp>  // for soa_span<>
+
+#include <makeshift/experimental/detail/buffer.hpp>  // for allocator_holder<>, allocate_storage<>(), deallocate_storage<>()
+#include <makeshift/experimental/detail/soa_vector.hpp>
+
+
+namespace makeshift {
+
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Resizable struct-of-arrays container which stores the elements of every type `Ts...` in a separate column. All columns share
+    // a single memory block obtained from `Allocator`, and every column is aligned to `Alignment` bytes.
+    //ᅟ
+    // Storage grows geometrically; when it grows, every column is moved to the new memory block. The container offers the same
+    // span-of-tuples interface as `soa_span<>`, and `span()` returns a `soa_span<>` view of the elements.
+    //
+template <typename Allocator, std::size_t Alignment, typename... Ts>
+class basic_soa_vector : private detail::allocator_holder<Allocator>
+{
+    static_assert(sizeof...(Ts) > 0, "struct-of-arrays container must have at least one column");
+    static_assert(std::conjunction_v<std::negation<std::disjunction<std::is_const<Ts>, std::is_reference<Ts>>>...>, "column types must not be const or reference types");
+    static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "alignment must be a power of 2");
+    static_assert(((Alignment >= alignof(Ts)) && ...), "alignment must satisfy the alignment requirements of all column types");
+    static_assert(std::is_same<typename std::allocator_traits<Allocator>::value_type, std::byte>::value, "allocator value type must be std::byte");
+
+private:
+    using Traits_ = std::allocator_traits<Allocator>;
+    using holder_ = detail::allocator_holder<Allocator>;
+
+    std::byte* block_;
+    std::tuple<Ts*...> data_;
+    std::size_t size_;
+    std::size_t capacity_;
+
+    [[nodiscard]] Allocator& _allocator(void) noexcept
+    {
+        return holder_::allocator();
+    }
+
+    [[nodiscard]] std::size_t _grown_capacity(std::size_t minCapacity) const noexcept
+    {
+        return std::max(minCapacity, 2*capacity_);
+    }
+
+        // Constructs the element at index `i` in every column from `std::get<I>(args)`, or value-initializes it if `args` is empty.
+        // If a constructor throws, the elements already constructed are destroyed.
+    template <std::size_t I = 0, typename ArgsT>
+    void _construct_element(std::size_t i, ArgsT&& args)
+    {
+        if constexpr (I != sizeof...(Ts))
+        {
+            auto column = std::get<I>(data_);
+            if constexpr (std::tuple_size<std::remove_reference_t<ArgsT>>::value == 0)
+            {
+                Traits_::construct(_allocator(), column + i);
+            }
+            else
+            {
+                Traits_::construct(_allocator(), column + i, std::get<I>(std::forward<ArgsT>(args)));
+            }
+            try
+            {
+                _construct_element<I + 1>(i, std::forward<ArgsT>(args));
+            }
+            catch (...)
+            {
+                Traits_::destroy(_allocator(), column + i);
+                throw;
+            }
+        }
+    }
+    void _destroy_element(std::size_t i) noexcept
+    {
+        makeshift::template_for(
+            [this, i](auto* column)
+            {
+                Traits_::destroy(_allocator(), column + i);
+            },
+            data_);
+    }
+    void _destroy_elements(void) noexcept
+    {
+        for (std::size_t i = size_; i != 0; --i)
+        {
+            _destroy_element(i - 1);
+        }
+        size_ = 0;
+    }
+    void _release(void) noexcept
+    {
+        _destroy_elements();
+        if (block_ != nullptr)
+        {
+            detail::deallocate_storage<std::byte, Alignment>(_allocator(), block_, detail::soa_block_size<Alignment, Ts...>(capacity_));
+        }
+        block_ = nullptr;
+        data_ = std::tuple<Ts*...>{ };
+        capacity_ = 0;
+    }
+
+        // Constructs the first `n` elements of every column in `dest` from the corresponding elements in `src`, which are moved
+        // if `Move` is true and if moving cannot throw. If a constructor throws, the elements already constructed are destroyed.
+    template <bool Move, std::size_t I = 0>
+    void _construct_columns(std::tuple<Ts*...> const& dest, std::tuple<Ts*...> const& src, std::size_t n)
+    {
+        if constexpr (I != sizeof...(Ts))
+        {
+            auto dst = std::get<I>(dest);
+            auto srcColumn = std::get<I>(src);
+            std::size_t i = 0;
+            try
+            {
+                for (; i != n; ++i)
+                {
+                    if constexpr (Move)
+                    {
+                        Traits_::construct(_allocator(), dst + i, std::move_if_noexcept(srcColumn[i]));
+                    }
+                    else
+                    {
+                        Traits_::construct(_allocator(), dst + i, std::as_const(srcColumn[i]));
+                    }
+                }
+                _construct_columns<Move, I + 1>(dest, src, n);
+            }
+            catch (...)
+            {
+                for (; i != 0; --i)
+                {
+                    Traits_::destroy(_allocator(), dst + (i - 1));
+                }
+                throw;
+            }
+        }
+    }
+
+        // Allocates a new memory block with the given capacity and moves or copies the elements of `src` to it. The current elements
+        // are released only after all elements have been transferred.
+    template <bool Move>
+    void _reallocate(std::size_t newCapacity, std::tuple<Ts*...> const& src, std::size_t n)
+    {
+        std::size_t newBlockSize = detail::soa_block_size<Alignment, Ts...>(newCapacity);
+        std::byte* newBlock = detail::allocate_storage<std::byte, Alignment>(_allocator(), newBlockSize);
+        auto newData = detail::soa_column_pointers<Alignment, Ts...>(newBlock, newCapacity);
+        try
+        {
+            _construct_columns<Move>(newData, src, n);
+        }
+        catch (...)
+        {
+            detail::deallocate_storage<std::byte, Alignment>(_allocator(), newBlock, newBlockSize);
+            throw;
+        }
+        _release();
+        block_ = newBlock;
+        data_ = newData;
+        size_ = n;
+        capacity_ = newCapacity;
+    }
+
+        // Takes over the memory block of `rhs`, which must be deallocatable with our allocator. Expects `*this` to be empty.
+    void _take(basic_soa_vector& rhs) noexcept
+    {
+        block_ = std::exchange(rhs.block_, nullptr);
+        data_ = std::exchange(rhs.data_, std::tuple<Ts*...>{ });
+        size_ = std::exchange(rhs.size_, 0);
+        capacity_ = std::exchange(rhs.capacity_, 0);
+    }
+
+public:
+    using allocator_type = Allocator;
+    using value_type = std::tuple<Ts...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::soa_reference<Ts...>;
+    using const_reference = detail::soa_reference<Ts const...>;
+    using iterator = detail::soa_span_iterator<Ts...>;
+    using const_iterator = detail::soa_span_iterator<Ts const...>;
+
+    basic_soa_vector(void) noexcept(noexcept(Allocator()))
+        : basic_soa_vector(Allocator())
+    {
+    }
+    explicit basic_soa_vector(Allocator const& alloc) noexcept
+        : holder_(alloc), block_(nullptr), data_{ }, size_(0), capacity_(0)
+    {
+    }
+    explicit basic_soa_vector(std::size_t count, Allocator const& alloc = Allocator())
+        : basic_soa_vector(alloc)
+    {
+        resize(count);
+    }
+    basic_soa_vector(basic_soa_vector const& rhs, Allocator const& alloc)
+        : basic_soa_vector(alloc)
+    {
+        if (rhs.size_ != 0)
+        {
+            _reallocate<false>(rhs.size_, rhs.data_, rhs.size_);
+        }
+    }
+    basic_soa_vector(basic_soa_vector const& rhs)
+        : basic_soa_vector(rhs, Traits_::select_on_container_copy_construction(rhs.get_allocator()))
+    {
+    }
+    basic_soa_vector(basic_soa_vector&& rhs) noexcept
+        : basic_soa_vector(rhs._allocator())
+    {
+        _take(rhs);
+    }
+    basic_soa_vector& operator =(basic_soa_vector const& rhs)
+    {
+        if (this != &rhs)
+        {
+            if constexpr (Traits_::propagate_on_container_copy_assignment::value)
+            {
+                if (_allocator() != rhs.get_allocator())
+                {
+                    _release();
+                }
+                _allocator() = rhs.get_allocator();
+            }
+            clear();
+            if (rhs.size_ > capacity_)
+            {
+                _reallocate<false>(rhs.size_, rhs.data_, rhs.size_);
+            }
+            else
+            {
+                _construct_columns<false>(data_, rhs.data_, rhs.size_);
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+    basic_soa_vector& operator =(basic_soa_vector&& rhs)
+        noexcept(Traits_::propagate_on_container_move_assignment::value || Traits_::is_always_equal::value)
+    {
+        if (this != &rhs)
+        {
+            _release();
+            if constexpr (Traits_::propagate_on_container_move_assignment::value)
+            {
+                _allocator() = std::move(rhs._allocator());
+                _take(rhs);
+            }
+            else if constexpr (Traits_::is_always_equal::value)
+            {
+                _take(rhs);
+            }
+            else
+            {
+                if (_allocator() == rhs._allocator())
+                {
+                    _take(rhs);
+                }
+                else
+                {
+                    _reallocate<true>(rhs.size_, rhs.data_, rhs.size_);
+                    rhs.clear();
+                }
+            }
+        }
+        return *this;
+    }
+    ~basic_soa_vector(void)
+    {
+        _release();
+    }
+
+    [[nodiscard]] Allocator get_allocator(void) const noexcept
+    {
+        return holder_::allocator();
+    }
+
+    [[nodiscard]] std::size_t size(void) const noexcept
+    {
+        return size_;
+    }
+    [[nodiscard]] bool empty(void) const noexcept
+    {
+        return size_ == 0;
+    }
+    [[nodiscard]] std::size_t capacity(void) const noexcept
+    {
+        return capacity_;
+    }
+
+    [[nodiscard]] iterator begin(void) noexcept
+    {
+        return { data_, 0 };
+    }
+    [[nodiscard]] iterator end(void) noexcept
+    {
+        return { data_, difference_type(size_) };
+    }
+    [[nodiscard]] const_iterator begin(void) const noexcept
+    {
+        return { data_, 0 };
+    }
+    [[nodiscard]] const_iterator end(void) const noexcept
+    {
+        return { data_, difference_type(size_) };
+    }
+    [[nodiscard]] const_iterator cbegin(void) const noexcept
+    {
+        return { data_, 0 };
+    }
+    [[nodiscard]] const_iterator cend(void) const noexcept
+    {
+        return { data_, difference_type(size_) };
+    }
+
+    [[nodiscard]] reference operator [](std::size_t i)
+    {
+        gsl_Expects(i < size_);
+
+        return { data_, difference_type(i) };
+    }
+    [[nodiscard]] const_reference operator [](std::size_t i) const
+    {
+        gsl_Expects(i < size_);
+
+        return { data_, difference_type(i) };
+    }
+    [[nodiscard]] reference front(void)
+    {
+        gsl_Expects(size_ != 0);
+
+        return { data_, 0 };
+    }
+    [[nodiscard]] const_reference front(void) const
+    {
+        gsl_Expects(size_ != 0);
+
+        return { data_, 0 };
+    }
+    [[nodiscard]] reference back(void)
+    {
+        gsl_Expects(size_ != 0);
+
+        return { data_, difference_type(size_ - 1) };
+    }
+    [[nodiscard]] const_reference back(void) const
+    {
+        gsl_Expects(size_ != 0);
+
+        return { data_, difference_type(size_ - 1) };
+    }
+
+        //
+        // Returns a `soa_span<>` view of the elements.
+        //
+    [[nodiscard]] soa_span<Ts...> span(void) noexcept
+    {
+        return std::apply(
+            [n = size_](auto*... columns)
+            {
+                return soa_span<Ts...>(gsl::span<Ts>(columns, n)...);
+            },
+            data_);
+    }
+    [[nodiscard]] soa_span<Ts const...> span(void) const noexcept
+    {
+        return std::apply(
+            [n = size_](auto*... columns)
+            {
+                return soa_span<Ts const...>(gsl::span<Ts const>(columns, n)...);
+            },
+            data_);
+    }
+
+        //
+        // Ensures that the container can hold `newCapacity` elements without reallocating.
+        //
+    void reserve(std::size_t newCapacity)
+    {
+        if (newCapacity > capacity_)
+        {
+            _reallocate<true>(newCapacity, data_, size_);
+        }
+    }
+
+    void resize(std::size_t newSize)
+    {
+        if (newSize < size_)
+        {
+            while (size_ != newSize) pop_back();
+        }
+        else
+        {
+            if (newSize > capacity_)
+            {
+                reserve(_grown_capacity(newSize));
+            }
+            for (; size_ != newSize; ++size_)
+            {
+                _construct_element(size_, std::tuple<>{ });
+            }
+        }
+    }
+
+        //
+        // Appends an element whose columns are constructed from the given arguments, one argument per column.
+        //ᅟ
+        //ᅟ    auto coo = soa_vector<int, int, double>{ };
+        //ᅟ    coo.emplace_back(i, j, v);
+        //
+    template <typename... ArgsT>
+    reference emplace_back(ArgsT&&... args)
+    {
+        static_assert(sizeof...(ArgsT) == sizeof...(Ts), "emplace_back() expects exactly one argument per column");
+
+        if (size_ == capacity_)
+        {
+                // The arguments might refer to elements of the container.
+            auto value = value_type(std::forward<ArgsT>(args)...);
+            reserve(_grown_capacity(size_ + 1));
+            _construct_element(size_, std::move(value));
+        }
+        else
+        {
+            _construct_element(size_, std::forward_as_tuple(std::forward<ArgsT>(args)...));
+        }
+        ++size_;
+        return back();
+    }
+    void push_back(value_type const& value)
+    {
+        std::apply(
+            [this](auto const&... elems)
+            {
+                emplace_back(elems...);
+            },
+            value);
+    }
+    void push_back(value_type&& value)
+    {
+        std::apply(
+            [this](auto&&... elems)
+            {
+                emplace_back(std::move(elems)...);
+            },
+            std::move(value));
+    }
+    void pop_back(void)
+    {
+        gsl_Expects(size_ != 0);
+
+        --size_;
+        _destroy_element(size_);
+    }
+    void clear(void) noexcept
+    {
+        _destroy_elements();
+    }
+
+    [[nodiscard]] friend bool operator ==(basic_soa_vector const& lhs, basic_soa_vector const& rhs)
+    {
+        if (lhs.size_ != rhs.size_) return false;
+        bool result = true;
+        makeshift::template_for(
+            [&result, n = lhs.size_](auto const* lhsColumn, auto const* rhsColumn)
+            {
+                result = result && std::equal(lhsColumn, lhsColumn + n, rhsColumn);
+            },
+            lhs.data_, rhs.data_);
+        return result;
+    }
+    [[nodiscard]] friend bool operator !=(basic_soa_vector const& lhs, basic_soa_vector const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+        // Implement tuple-like interface for `basic_soa_vector<>`.
+    template <std::size_t I>
+    [[nodiscard]] friend gsl::span<nth_type_t<I, Ts...>>
+    get(basic_soa_vector& self) noexcept
+    {
+        return { std::get<I>(self.data_), self.size_ };
+    }
+    template <std::size_t I>
+    [[nodiscard]] friend gsl::span<nth_type_t<I, Ts...> const>
+    get(basic_soa_vector const& self) noexcept
+    {
+        return { std::get<I>(self.data_), self.size_ };
+    }
+};
+
+
+    //
+    // Resizable struct-of-arrays container with cache-line aligned columns.
+    //ᅟ
+    //ᅟ    auto coo = soa_vector<int, int, double>{ };
+    //ᅟ    coo.push_back({ i, j, v });
+    //ᅟ    auto [is, js, vs] = coo.span(); // `gsl::span<>` objects referring to the columns
+    //ᅟ    for (auto [i, j, v] : coo) { ... }
+    //
+template <typename... Ts>
+using soa_vector = basic_soa_vector<std::allocator<std::byte>, detail::soa_default_alignment, Ts...>;
+
+
+    //
+    // Resizable struct-of-arrays container with one column for every member of the reflected type `T`. The column types are
+    // derived from the member pointers in `metadata::members<T>()`.
+    //ᅟ
+    //ᅟ    struct COO { int i; int j; double v; };
+    //ᅟ    constexpr auto reflect(gsl::type_identity<COO>) { return value_tuple{ &COO::i, &COO::j, &COO::v }; }
+    //ᅟ
+    //ᅟ    auto coo = soa_vector_for<COO>{ }; // returns `soa_vector<int, int, double>`
+    //
+template <typename T, typename ReflectorT = reflector>
+using soa_vector_for = detail::soa_from_members_t<soa_vector, decltype(metadata::members<T, ReflectorT>())>;
+
+
+    //
+    // Resizable struct-of-arrays container for the reflected type `T`, which must be default-constructible. Every member in
+    // `metadata::members<T>()` is stored in a separate column.
+    //ᅟ
+    // Elements are accessed through proxy references which can be converted to and assigned from `T`, and which give access
+    // to individual members through member pointers:
+    //ᅟ
+    //ᅟ    struct Particle { double x; double v; int id; };
+    //ᅟ    constexpr auto reflect(gsl::type_identity<Particle>) { return value_tuple{ &Particle::x, &Particle::v, &Particle::id }; }
+    //ᅟ
+    //ᅟ    auto particles = soa_of<Particle>{ };
+    //ᅟ    particles.push_back(Particle{ 0., 1., 42 });
+    //ᅟ    particles[0]->*&Particle::x += dt*(particles[0]->*&Particle::v);
+    //ᅟ    Particle p = particles[0];
+    //ᅟ    auto xs = particles.column<&Particle::x>(); // returns `gsl::span<double>`
+    //
+    // Iterating over the container yields the tuple-like proxies of `soa_vector<>`.
+    //
+template <typename T, typename ReflectorT = reflector>
+class soa_of : public soa_vector_for<T, ReflectorT>
+{
+    static_assert(metadata::is_available(metadata::members<T, ReflectorT>()), "no member metadata was defined for type T");
+
+private:
+    using base_ = soa_vector_for<T, ReflectorT>;
+    using members_ = decltype(metadata::members<T, ReflectorT>());
+    template <typename... Ts> using record_reference_ = detail::soa_record_reference<T, ReflectorT, Ts...>;
+    template <typename... Ts> using const_record_reference_ = detail::soa_record_reference<T, ReflectorT, Ts const...>;
+    static constexpr std::size_t numMembers_ = std::tuple_size<std::remove_const_t<std::remove_reference_t<members_>>>::value;
+
+    template <typename SelfT, std::size_t... Is>
+    [[nodiscard]] static auto _column_pointers(SelfT& self, std::index_sequence<Is...>) noexcept
+    {
+        using std::get;
+        return std::tuple{ get<Is>(self).data()... };
+    }
+
+public:
+    using record_reference = detail::soa_from_members_t<record_reference_, members_>;
+    using const_record_reference = detail::soa_from_members_t<const_record_reference_, members_>;
+
+    using base_::base_;
+    using base_::push_back;
+
+    [[nodiscard]] record_reference operator [](std::size_t i)
+    {
+        gsl_Expects(i < this->size());
+
+        return { _column_pointers(static_cast<base_&>(*this), std::make_index_sequence<numMembers_>{ }), std::ptrdiff_t(i) };
+    }
+    [[nodiscard]] const_record_reference operator [](std::size_t i) const
+    {
+        gsl_Expects(i < this->size());
+
+        return { _column_pointers(static_cast<base_ const&>(*this), std::make_index_sequence<numMembers_>{ }), std::ptrdiff_t(i) };
+    }
+
+        //
+        // Appends the members of `value` to the columns.
+        //
+    void push_back(T const& value)
+    {
+        std::apply(
+            [this, &value](auto... members)
+            {
+                this->emplace_back(value.*members...);
+            },
+            metadata::members<T, ReflectorT>());
+    }
+
+        //
+        // Returns a span of the column which stores the member `M`.
+        //
+    template <auto M>
+    [[nodiscard]] auto column(void) noexcept
+    {
+        constexpr std::size_t i = detail::search_member_index<T, ReflectorT>(M);
+        static_assert(i != std::size_t(-1), "M is not a reflected member of T");
+        using std::get;
+        return get<i>(static_cast<base_&>(*this));
+    }
+    template <auto M>
+    [[nodiscard]] auto column(void) const noexcept
+    {
+        constexpr std::size_t i = detail::search_member_index<T, ReflectorT>(M);
+        static_assert(i != std::size_t(-1), "M is not a reflected member of T");
+        using std::get;
+        return get<i>(static_cast<base_ const&>(*this));
+    }
+};
+
+
+    //
+    // Scatters the members of the elements in `src` to the columns of `dst`, which must have one column for every member in
+    // `metadata::members<T>()`. The columns are filled one after another.
+    //ᅟ
+    //ᅟ    auto aos = std::vector<COO>{ ... };
+    //ᅟ    auto soa = soa_vector_for<COO>(aos.size());
+    //ᅟ    aos_to_soa(gsl::span(aos), soa.span());
+    //
+template <typename ReflectorT = reflector, typename T, typename... Ts>
+void
+aos_to_soa(gsl::span<T> src, soa_span<Ts...> dst)
+{
+    using U = std::remove_const_t<T>;
+    static_assert(std::is_same<soa_vector_for<U, ReflectorT>, soa_vector<std::remove_const_t<Ts>...>>::value, "column types must match the member types of T");
+    gsl_Expects(src.size() == dst.size());
+
+    makeshift::template_for<sizeof...(Ts)>(
+        [src, dst](auto iC)
+        {
+            constexpr auto member = std::get<decltype(iC)::value>(metadata::members<U, ReflectorT>());
+            using std::get;
+            auto column = get<decltype(iC)::value>(dst);
+            for (std::size_t k = 0, n = src.size(); k != n; ++k)
+            {
+                column[k] = src[k].*member;
+            }
+        },
+        tuple_index);
+}
+
+    //
+    // Returns a struct-of-arrays container which holds the members of the elements in `src`.
+    //ᅟ
+    //ᅟ    auto aos = std::vector<COO>{ ... };
+    //ᅟ    auto soa = aos_to_soa(gsl::span(aos)); // returns `soa_of<COO>`
+    //
+template <typename ReflectorT = reflector, typename T>
+[[nodiscard]] soa_of<std::remove_const_t<T>, ReflectorT>
+aos_to_soa(gsl::span<T> src)
+{
+    auto result = soa_of<std::remove_const_t<T>, ReflectorT>(src.size());
+    makeshift::aos_to_soa<ReflectorT>(src, result.span());
+    return result;
+}
+
+    //
+    // Gathers the columns of `src` into the members of the elements in `dst`. `src` must have one column for every member in
+    // `metadata::members<T>()`. The columns are processed one after another.
+    //ᅟ
+    //ᅟ    auto aos = std::vector<COO>(soa.size());
+    //ᅟ    soa_to_aos(soa.span(), gsl::span(aos));
+    //
+template <typename ReflectorT = reflector, typename T, typename... Ts>
+void
+soa_to_aos(soa_span<Ts...> src, gsl::span<T> dst)
+{
+    static_assert(std::is_same<soa_vector_for<T, ReflectorT>, soa_vector<std::remove_const_t<Ts>...>>::value, "column types must match the member types of T");
+    gsl_Expects(src.size() == dst.size());
+
+    makeshift::template_for<sizeof...(Ts)>(
+        [src, dst](auto iC)
+        {
+            constexpr auto member = std::get<decltype(iC)::value>(metadata::members<T, ReflectorT>());
+            using std::get;
+            auto column = get<decltype(iC)::value>(src);
+            for (std::size_t k = 0, n = dst.size(); k != n; ++k)
+            {
+                dst[k].*member = column[k];
+            }
+        },
+        tuple_index);
+}
+
+
+
+namespace pmr {
+
+
+    //
+    // Resizable struct-of-arrays container with cache-line aligned columns which obtains its memory from a
+    // `std::pmr::memory_resource`.
+    //
+template <typename... Ts>
+using soa_vector = basic_soa_vector<std::pmr::polymorphic_allocator<std::byte>, detail::soa_default_alignment, Ts...>;
+
+
+} // namespace pmr
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_SOA_VECTOR_HPP_
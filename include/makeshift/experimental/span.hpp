@@ -74,22 +74,22 @@ public:
     [[nodiscard]] constexpr iterator
     begin(void) const noexcept
     {
-        return { &data_, 0 };
+        return { data_, 0 };
     }
     [[nodiscard]] constexpr iterator
     end(void) const noexcept
     {
-        return { &data_, difference_type(size_) };
+        return { data_, difference_type(size_) };
     }
     [[nodiscard]] constexpr const_iterator
     cbegin(void) const noexcept
     {
-        return { &data_, 0 };
+        return { data_, 0 };
     }
     [[nodiscard]] constexpr const_iterator
     cend(void) const noexcept
     {
-        return { &data_, difference_type(size_) };
+        return { data_, difference_type(size_) };
     }
 
     [[nodiscard]] constexpr reference
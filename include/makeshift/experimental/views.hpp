@@ -0,0 +1,151 @@
+
+#ifndef INCLUDED_MAKESHIFT_EXPERIMENTAL_VIEWS_HPP_
+#define INCLUDED_MAKESHIFT_EXPERIMENTAL_VIEWS_HPP_
+
+
+#include <utility>  // for move(), forward<>()
+
+#include <gsl-lite/gsl-lite.hpp>  // for index, diff, gsl_Expects(), gsl_CPP17_OR_GREATER
+
+#if !gsl_CPP17_OR_GREATER
+# error makeshift requires C++17 mode or higher
+#endif // !gsl_CPP17_OR_GREATER
+
+#include <makeshift/ranges.hpp>  // for index_range
+
+#include <makeshift/experimental/detail/views.hpp>
+
+
+namespace makeshift {
+
+namespace gsl = ::gsl_lite;
+
+
+    //
+    // Lazy views over ranges. Views do not allocate; elements are computed on the fly while the view is being traversed.
+    // Views can be passed to `range_zip()` and to the `range_*()` algorithms.
+    //
+    // A view holds the underlying range by reference if it was passed as an lvalue, and by value otherwise. Nesting views of
+    // the same kind fuses them into a single view if the inner view is an rvalue:
+    //ᅟ
+    //ᅟ    auto v = transform_view(transform_view(vec, f), g);
+    //ᅟ    // equivalent to `transform_view(vec, [](auto&& x) { return g(f(x)); })`
+    //
+    // Views can be built on common ranges only, i.e. ranges whose begin and end iterators have the same type.
+    //
+
+
+    //
+    // Returns a view of the index values [0, num).
+    //ᅟ
+    //ᅟ    range_for(
+    //ᅟ        [](gsl::index i, int& val) { val = int(i*i); },
+    //ᅟ        iota_view(3), vec);
+    //
+[[nodiscard]] constexpr index_range
+iota_view(gsl::index num)
+{
+    return index_range(num);
+}
+
+    //
+    // Returns a view of the index values [first, last).
+    //
+[[nodiscard]] constexpr index_range
+iota_view(gsl::index first, gsl::index last)
+{
+    return index_range(first, last);
+}
+
+
+    //
+    // Returns a view of the elements of the given range with indices [first, last). The bounds are clamped to the size of the
+    // range.
+    //ᅟ
+    //ᅟ    auto v = sub_view(std::vector{ 1, 2, 3, 4 }, 1, 3);
+    //ᅟ    // represents the sequence { 2, 3 }
+    //
+template <typename R>
+[[nodiscard]] constexpr auto
+sub_view(R&& range, gsl::index first, gsl::index last)
+{
+    gsl_Expects(first >= 0 && first <= last);
+
+    return detail::make_sub_range(std::forward<R>(range), first, last);
+}
+
+
+    //
+    // Returns a view of the first `n` elements of the given range, or of all elements if the range has less than `n` elements.
+    //
+template <typename R>
+[[nodiscard]] constexpr auto
+take_view(R&& range, gsl::index n)
+{
+    gsl_Expects(n >= 0);
+
+    return detail::make_sub_range(std::forward<R>(range), 0, n);
+}
+
+
+    //
+    // Returns a view of the given range with the first `n` elements skipped.
+    //
+template <typename R>
+[[nodiscard]] constexpr auto
+drop_view(R&& range, gsl::index n)
+{
+    gsl_Expects(n >= 0);
+
+    return detail::make_sub_range(std::forward<R>(range), n, detail::unbounded_index);
+}
+
+
+    //
+    // Returns a view of the elements of the given range transformed by the given function.
+    //ᅟ
+    //ᅟ    auto squares = transform_view(iota_view(4), [](gsl::index i) { return i*i; });
+    //ᅟ    // represents the sequence { 0, 1, 4, 9 }
+    //
+template <typename R, typename F>
+[[nodiscard]] constexpr auto
+transform_view(R&& range, F func)
+{
+    return detail::make_transform_range(std::forward<R>(range), std::move(func));
+}
+
+
+    //
+    // Returns a view of the elements of the given range which satisfy the given predicate.
+    //ᅟ
+    //ᅟ    auto odd = filter_view(std::vector{ 1, 2, 3, 4 }, [](int i) { return i % 2 != 0; });
+    //ᅟ    // represents the sequence { 1, 3 }
+    //
+template <typename R, typename P>
+[[nodiscard]] constexpr auto
+filter_view(R&& range, P pred)
+{
+    return detail::make_filter_range(std::forward<R>(range), std::move(pred));
+}
+
+
+    //
+    // Returns a view of every `stride`-th element of the given range, starting with the first element.
+    //ᅟ
+    //ᅟ    auto v = stride_view(std::vector{ 1, 2, 3, 4, 5 }, 2);
+    //ᅟ    // represents the sequence { 1, 3, 5 }
+    //
+template <typename R>
+[[nodiscard]] constexpr auto
+stride_view(R&& range, gsl::diff stride)
+{
+    gsl_Expects(stride > 0);
+
+    return detail::make_stride_range(std::forward<R>(range), stride);
+}
+
+
+} // namespace makeshift
+
+
+#endif // INCLUDED_MAKESHIFT_EXPERIMENTAL_VIEWS_HPP_
@@ -25,7 +25,7 @@ namespace gsl = ::gsl_lite;
 
 using reflector = detail::reflector;
 constexpr auto reflector_c = reflector{ };
-template <typename T, typename ReflectorT = reflector> constexpr auto metadata_v = ReflectorT{ }(gsl::type_identity<std::remove_cv_t<T>>{ });
+template <typename T, typename ReflectorT = reflector> constexpr auto metadata_v = detail::raw_metadata_v<std::remove_cv_t<T>, ReflectorT>;
 template <typename T, typename ReflectorT = reflector> using metadata_t = std::remove_const_t<decltype(metadata_v<T, ReflectorT>)>;
 
 
@@ -55,56 +55,56 @@ template <typename T, template <typename...> class PredT, typename... PredArgsT,
 [[nodiscard]] constexpr auto
 extract(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
-    return detail::extract_metadata<void, detail::predicate_adaptor<PredT>::template type, 0>(detail::get_metadata<T, ReflectorT>(), type_sequence<PredArgsT...>{ });
+    return detail::extracted_metadata_v<std::remove_const_t<T>, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>, ReflectorT>;
 }
 template <typename T, int Occurrence, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
 [[nodiscard]] constexpr auto
 extract(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
     static_assert(Occurrence >= 0);
-    return detail::extract_metadata<void, detail::predicate_adaptor<PredT>::template type, Occurrence>(detail::get_metadata<T, ReflectorT>(), type_sequence<PredArgsT...>{ });
+    return detail::extracted_metadata_v<std::remove_const_t<T>, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>, ReflectorT>;
 }
 
 template <typename T, typename V, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] constexpr auto
 extract_for_values(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
-    return detail::extract_value_metadata<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>>(detail::get_metadata<T, ReflectorT>());
+    return detail::value_metadata_v<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>, ReflectorT>;
 }
 template <typename T, typename V, int Occurrence, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] constexpr auto
 extract_for_values(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
     static_assert(Occurrence >= 0);
-    return detail::extract_value_metadata<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>>(detail::get_metadata<T, ReflectorT>());
+    return detail::value_metadata_v<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>, ReflectorT>;
 }
 
 template <typename T, typename V, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] constexpr auto
 extract_for_exclusive_members(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
-    return detail::extract_member_metadata<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>>(detail::get_metadata<T, ReflectorT>());
+    return detail::exclusive_member_metadata_v<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>, ReflectorT>;
 }
 template <typename T, typename V, int Occurrence, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] constexpr auto
 extract_for_exclusive_members(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
     static_assert(Occurrence >= 0);
-    return detail::extract_member_metadata<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>>(detail::get_metadata<T, ReflectorT>());
+    return detail::exclusive_member_metadata_v<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>, ReflectorT>;
 }
 
 template <typename T, typename V, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] constexpr auto
 extract_for_members(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
-    return detail::extract_all_member_metadata<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>, ReflectorT>();
+    return detail::member_metadata_v<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, 0, type_sequence<PredArgsT...>, ReflectorT>;
 }
 template <typename T, typename V, int Occurrence, template <typename...> class PredT, typename... PredArgsT, typename ReflectorT = reflector>
-[[nodiscard]] constexpr decltype(auto)
+[[nodiscard]] constexpr auto
 extract_for_members(ReflectorT = { }, type_sequence<PredArgsT...> = { })
 {
     static_assert(Occurrence >= 0);
-    return detail::extract_all_member_metadata<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>, ReflectorT>();
+    return detail::member_metadata_v<std::remove_const_t<T>, V, detail::predicate_adaptor<PredT>::template type, Occurrence, type_sequence<PredArgsT...>, ReflectorT>;
 }
 
 
@@ -126,23 +126,21 @@ template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr auto
 bases(ReflectorT = { })
 {
-    return detail::extract_bases<std::remove_const_t<T>>(detail::get_metadata<T, ReflectorT>());
+    return detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.bases;
 }
 
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr decltype(auto)
 values(ReflectorT = { })
 {
-    //return detail::extract_values<std::remove_const_t<T>>(detail::get_metadata<T, ReflectorT>());
-    return detail::value_store<std::remove_const_t<T>, ReflectorT>::value;
+    return detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.values;
 }
 
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr decltype(auto)
 value_names(ReflectorT = { })
 {
-    //return metadata::extract_for_values<T, std::string_view, std::is_convertible, std::string_view>(ReflectorT{ });
-    return detail::value_name_store<std::remove_const_t<T>, ReflectorT>::value;
+    return detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.value_names;
 }
 
 template <typename T, typename ReflectorT = reflector>
@@ -156,16 +154,14 @@ template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr decltype(auto)
 exclusive_members(ReflectorT = { })
 {
-    //return detail::extract_members<std::remove_const_t<T>>(detail::get_metadata<T, ReflectorT>());
-    return detail::exclusive_member_store<std::remove_const_t<T>, ReflectorT>::value;
+    return detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.exclusive_members;
 }
 
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr decltype(auto)
 exclusive_member_names(ReflectorT = { })
 {
-    //return metadata::extract_for_exclusive_members<T, std::string_view, std::is_convertible, std::string_view>(ReflectorT{ });
-    return detail::exclusive_member_name_store<std::remove_const_t<T>, ReflectorT>::value;
+    return detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.exclusive_member_names;
 }
 
 template <typename T, typename ReflectorT = reflector>
@@ -179,23 +175,20 @@ template <template <typename...> class TupleT, typename T, typename ReflectorT =
 [[nodiscard]] constexpr decltype(auto)
 members(ReflectorT = { })
 {
-    //return detail::all_members<std::remove_const_t<T>, TupleT, ReflectorT>();
-    return detail::member_store<TupleT, std::remove_const_t<T>, ReflectorT>::value;
+    return detail::member_tuple_v<TupleT, std::remove_const_t<T>, ReflectorT>;
 }
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr decltype(auto)
 members(ReflectorT = { })
 {
-    //return detail::all_members<std::remove_const_t<T>, std::tuple, ReflectorT>();
-    return detail::member_store<std::tuple, std::remove_const_t<T>, ReflectorT>::value;
+    return detail::member_tuple_v<std::tuple, std::remove_const_t<T>, ReflectorT>;
 }
 
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr auto
 member_names(ReflectorT = { })
 {
-    //return metadata::extract_for_members<T, std::string_view, std::is_convertible, std::string_view>(ReflectorT{ });
-    return detail::member_name_store<std::remove_const_t<T>, ReflectorT>::value;
+    return detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.member_names;
 }
 
 template <typename T, typename ReflectorT = reflector>
@@ -210,7 +203,7 @@ template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
 search_value_index(T value, ReflectorT = { })
 {
-    constexpr auto const& values = detail::value_store<std::remove_const_t<T>, ReflectorT>::value;
+    constexpr auto const& values = detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.values;
     static_assert(metadata::is_available(values));
     return detail::search_index(value, values);
 }
@@ -227,9 +220,9 @@ template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
 search_value_index_by_name(std::string_view name, ReflectorT = { })
 {
-    constexpr auto const& names = detail::value_name_store<std::remove_const_t<T>, ReflectorT>::value;
+    constexpr auto const& names = detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.value_names;
     static_assert(metadata::is_available(names));
-    return detail::search_index(name, names);
+    return detail::value_name_hash_index_v<std::remove_const_t<T>, ReflectorT>.search(name);
 }
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
@@ -244,9 +237,9 @@ template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
 search_exclusive_member_index_by_name(std::string_view name, ReflectorT = { })
 {
-    constexpr auto const& names = detail::exclusive_member_name_store<std::remove_const_t<T>, ReflectorT>::value;
+    constexpr auto const& names = detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.exclusive_member_names;
     static_assert(metadata::is_available(names));
-    return detail::search_index(name, names);
+    return detail::exclusive_member_name_hash_index_v<std::remove_const_t<T>, ReflectorT>.search(name);
 }
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
@@ -261,9 +254,9 @@ template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
 search_member_index_by_name(std::string_view name, ReflectorT = { })
 {
-    constexpr auto const& names = detail::member_name_store<std::remove_const_t<T>, ReflectorT>::value;
+    constexpr auto const& names = detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.member_names;
     static_assert(metadata::is_available(names));
-    return detail::search_index(name, names);
+    return detail::member_name_hash_index_v<std::remove_const_t<T>, ReflectorT>.search(name);
 }
 template <typename T, typename ReflectorT = reflector>
 [[nodiscard]] constexpr gsl::index
@@ -279,7 +272,7 @@ template <typename T, typename ReflectorT = reflector, typename NameC>
 [[nodiscard]] constexpr auto
 search_exclusive_member_by_name(NameC nameC, ReflectorT = { })
 {
-    constexpr auto const& members = detail::exclusive_member_store<std::remove_const_t<T>, ReflectorT>::value;
+    constexpr auto const& members = detail::metadata_record_v<std::remove_const_t<T>, ReflectorT>.exclusive_members;
     static_assert(metadata::is_available(members));
     constexpr auto maybeIndex = metadata::search_exclusive_member_index_by_name<T, ReflectorT>(nameC());
     if constexpr (maybeIndex >= 0)
@@ -302,7 +295,7 @@ template <typename T, typename ReflectorT = reflector, typename NameC>
 [[nodiscard]] constexpr auto
 search_member_by_name(NameC nameC, ReflectorT = { })
 {
-    constexpr auto const& members = detail::member_store<std::tuple, std::remove_const_t<T>, ReflectorT>::value;
+    constexpr auto const& members = detail::member_tuple_v<std::tuple, std::remove_const_t<T>, ReflectorT>;
     static_assert(metadata::is_available(members));
     constexpr auto maybeIndex = metadata::search_member_index_by_name<T, ReflectorT>(nameC());
     if constexpr (maybeIndex >= 0)
@@ -322,6 +315,18 @@ find_member_by_name(NameC nameC, ReflectorT = { })
 }
 
 
+    // Invokes `func(member)` with a reference to the member of `obj` with the given name. Returns `false` if `T` has no member
+    // with the given name. The member is looked up in a compile-time hash index and dispatched through a jump table.
+template <typename T, typename F, typename ReflectorT = reflector>
+bool
+visit_member_by_name(T& obj, std::string_view name, F&& func, ReflectorT = { })
+{
+    gsl::index i = metadata::search_member_index_by_name<std::remove_const_t<T>, ReflectorT>(name);
+    if (i < 0) return false;
+    detail::member_visitor_table_v<T, ReflectorT, std::remove_reference_t<F>>[i](obj, func);
+    return true;
+}
+
 } // namespace metadata
 
 } // namespace makeshift
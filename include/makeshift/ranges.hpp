@@ -116,6 +116,11 @@ public:
     {
         return const_iterator(last_);
     }
+    constexpr std::size_t
+    size(void) const noexcept
+    {
+        return std::size_t(last_ - first_);
+    }
 };
 
 
@@ -1,7 +1,18 @@
 
 #include <makeshift/experimental/algorithm.hpp>
+#include <makeshift/experimental/parallel.hpp>  // for sort_by_members_parallel()
+#include <makeshift/experimental/span.hpp>      // for make_soa_span()
+#include <makeshift/tuple.hpp>                  // for value_tuple<>
+#include <makeshift/constval.hpp>               // for MAKESHIFT_CONSTVAL()
 
-#include <gsl-lite/gsl-lite.hpp>
+#include <tuple>
+#include <cmath>      // for signbit()
+#include <random>
+#include <vector>
+#include <cstdint>    // for int8_t, int32_t, uint16_t
+#include <algorithm>  // for stable_sort()
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, index, dim, make_span()
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -12,7 +23,127 @@ namespace mk = ::makeshift;
 namespace gsl = ::gsl_lite;
 
 
-// TODO: add tests
+enum class Priority : std::int8_t { low = -1, normal = 0, high = 1 };
+
+struct COO
+{
+    std::int32_t i;
+    std::int32_t j;
+    double v;
+    Priority priority;
+};
+constexpr auto
+reflect(gsl::type_identity<COO>)
+{
+    return mk::value_tuple{ &COO::i, &COO::j, &COO::v, &COO::priority };
+}
+
+std::vector<COO>
+make_random_entries(gsl::dim n, std::int32_t maxIndex)
+{
+    auto rng = std::mt19937{ 42 };
+    auto indexDist = std::uniform_int_distribution<std::int32_t>(-maxIndex, maxIndex);
+    auto valueDist = std::uniform_real_distribution<double>(-1., 1.);
+    auto priorityDist = std::uniform_int_distribution<int>(-1, 1);
+    auto result = std::vector<COO>(std::size_t(n));
+    for (auto& entry : result)
+    {
+        entry = { indexDist(rng), indexDist(rng), valueDist(rng), Priority(priorityDist(rng)) };
+    }
+    return result;
+}
+
+bool
+operator ==(COO const& lhs, COO const& rhs)
+{
+    return lhs.i == rhs.i && lhs.j == rhs.j && lhs.v == rhs.v && lhs.priority == rhs.priority;
+}
+
+
+TEST_CASE("sort_by_members()")
+{
+    auto ijC = MAKESHIFT_CONSTVAL(std::tuple{ &COO::i, &COO::j });
+    auto lessIJ = [](COO const& lhs, COO const& rhs)
+    {
+        return std::tie(lhs.i, lhs.j) < std::tie(rhs.i, rhs.j);
+    };
+
+    SECTION("matches std::stable_sort()")
+    {
+        auto entries = make_random_entries(1000, 20);
+        auto expected = entries;
+        std::stable_sort(expected.begin(), expected.end(), lessIJ);
+
+        mk::sort_by_members(entries.begin(), entries.end(), ijC);
+        CHECK(entries == expected);
+    }
+    SECTION("enums and floating-point members")
+    {
+        auto entries = make_random_entries(500, 3);
+        entries[7].v = 0.;
+        entries[8].v = -0.;
+        entries[8].priority = entries[7].priority;
+        auto expected = entries;
+        std::stable_sort(expected.begin(), expected.end(),
+            [](COO const& lhs, COO const& rhs)
+            {
+                    // IEEE 754 total order: negative zero precedes positive zero.
+                return std::tuple{ lhs.priority, lhs.v, !std::signbit(lhs.v) } < std::tuple{ rhs.priority, rhs.v, !std::signbit(rhs.v) };
+            });
+
+        mk::sort_by_members(entries.begin(), entries.end(), MAKESHIFT_CONSTVAL(std::tuple{ &COO::priority, &COO::v }));
+        CHECK(entries == expected);
+        for (gsl::index k = 0, n = gsl::dim(entries.size()); k != n; ++k)
+        {
+            CHECK(std::signbit(entries[k].v) == std::signbit(expected[k].v));
+        }
+    }
+    SECTION("permutation applied to soa_span<>")
+    {
+        auto entries = make_random_entries(200, 10);
+        auto rows = std::vector<std::int32_t>(entries.size());
+        auto values = std::vector<double>(entries.size());
+        for (gsl::index k = 0, n = gsl::dim(entries.size()); k != n; ++k)
+        {
+            rows[k] = entries[k].i;
+            values[k] = entries[k].v;
+        }
+
+        auto permutation = mk::sort_permutation_by_members(entries.begin(), entries.end(), ijC);
+        auto span = mk::make_soa_span(gsl::make_span(rows), gsl::make_span(values));
+        mk::apply_permutation(span.begin(), span.end(), permutation.begin());
+
+        std::stable_sort(entries.begin(), entries.end(), lessIJ);
+        for (gsl::index k = 0, n = gsl::dim(entries.size()); k != n; ++k)
+        {
+            CHECK(rows[k] == entries[k].i);
+            CHECK(values[k] == entries[k].v);
+        }
+    }
+    SECTION("trivial ranges")
+    {
+        auto entries = std::vector<COO>{ };
+        mk::sort_by_members(entries.begin(), entries.end(), ijC);
+        CHECK(entries.empty());
+
+        entries.assign(5, COO{ 1, 2, 3., Priority::high });
+        for (gsl::index k = 0; k != 5; ++k)
+        {
+            entries[k].v = double(k);
+        }
+        auto permutation = mk::sort_permutation_by_members(entries.begin(), entries.end(), ijC);
+        CHECK(permutation == std::vector<gsl::index>{ 0, 1, 2, 3, 4 });
+    }
+    SECTION("parallel")
+    {
+        auto entries = make_random_entries(gsl::dim(1) << 17, 1000);
+        auto expected = entries;
+        std::stable_sort(expected.begin(), expected.end(), lessIJ);
+
+        mk::sort_by_members_parallel(entries.begin(), entries.end(), ijC);
+        CHECK(entries == expected);
+    }
+}
 
 
 } // anonymous namespace
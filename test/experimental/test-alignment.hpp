@@ -0,0 +1,26 @@
+// Alignment helper shared by the tests of the experimental containers and allocators.
+
+
+#ifndef INCLUDED_MAKESHIFT_TEST_ALIGNMENT_HPP_
+#define INCLUDED_MAKESHIFT_TEST_ALIGNMENT_HPP_
+
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uintptr_t
+
+
+namespace test {
+
+
+    // Returns whether `ptr` is a multiple of `alignment`.
+inline bool
+is_aligned(void const* ptr, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+
+} // namespace test
+
+
+#endif // INCLUDED_MAKESHIFT_TEST_ALIGNMENT_HPP_
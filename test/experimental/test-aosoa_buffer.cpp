@@ -0,0 +1,228 @@
+
+#include <makeshift/experimental/aosoa_buffer.hpp>
+#include <makeshift/experimental/span.hpp>
+#include <makeshift/algorithm.hpp>
+
+#include <tuple>
+#include <memory>           // for unique_ptr<>, make_unique<>(), allocator<>
+#include <string>
+#include <cstddef>          // for size_t, byte
+#include <stdexcept>        // for runtime_error
+#include <utility>          // for move(), swap()
+#include <algorithm>        // for sort()
+#include <memory_resource>  // for pmr::monotonic_buffer_resource
+
+#include <gsl-lite/gsl-lite.hpp>  // for index
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "test-alignment.hpp"  // for is_aligned()
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+using test::is_aligned;
+
+
+struct ThrowingCopy
+{
+    int value = 0;
+    bool throwOnCopy = false;
+
+    ThrowingCopy(void) = default;
+    ThrowingCopy(ThrowingCopy const& rhs)
+        : value(rhs.value), throwOnCopy(rhs.throwOnCopy)
+    {
+        if (throwOnCopy) throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy& operator =(ThrowingCopy const&) = default;
+};
+
+
+TEST_CASE("aosoa_buffer")
+{
+    using std::get;
+
+    SECTION("layout")
+    {
+        auto buf = mk::aosoa_buffer<4, char, double, int>(10);
+        CHECK(buf.size() == 10);
+        CHECK(buf.num_tiles() == 3);
+        CHECK(buf.padded_size() == 12);
+        CHECK(buf.tile_size == 4);
+
+        auto [c0, d0, i0] = buf.tile(0);
+        auto [c1, d1, i1] = buf.tile(1);
+        CHECK(c0.size() == 4);
+        CHECK(is_aligned(c0.data(), 64));
+        CHECK(is_aligned(d0.data(), 64));
+        CHECK(is_aligned(i0.data(), 64));
+        CHECK(reinterpret_cast<char*>(d0.data()) >= c0.data() + 4);
+        CHECK(reinterpret_cast<char*>(i0.data()) >= reinterpret_cast<char*>(d0.data() + 4));
+        CHECK(reinterpret_cast<char*>(c1.data()) >= reinterpret_cast<char*>(i0.data() + 4));
+        CHECK(&get<1>(buf[5]) == &d1[1]);
+    }
+    SECTION("columns of all tiles are aligned")
+    {
+        auto buf = mk::aosoa_buffer<4, float, double, char>(20);
+        for (std::size_t t = 0; t != buf.num_tiles(); ++t)
+        {
+            auto [f, d, c] = buf.tile(t);
+            CHECK(is_aligned(f.data(), 64));
+            CHECK(is_aligned(d.data(), 64));
+            CHECK(is_aligned(c.data(), 64));
+        }
+
+        auto buf16 = mk::basic_aosoa_buffer<std::allocator<std::byte>, 4, 16, float, double, char>(20);
+        auto [f0, d0, c0] = buf16.tile(0);
+        auto [f1, d1, c1] = buf16.tile(1);
+        CHECK(reinterpret_cast<char*>(d0.data()) == reinterpret_cast<char*>(f0.data() + 4));
+        CHECK(reinterpret_cast<char*>(c0.data()) == reinterpret_cast<char*>(d0.data() + 4));
+        CHECK(reinterpret_cast<char*>(f1.data()) == c0.data() + 16);
+        CHECK(is_aligned(f1.data(), 16));
+        CHECK(is_aligned(d1.data(), 16));
+        CHECK(is_aligned(c1.data(), 16));
+    }
+    SECTION("element access")
+    {
+        auto buf = mk::aosoa_buffer<8, int, std::string>(13);
+        for (auto&& [i, s] : buf)
+        {
+            CHECK(i == 0);
+            CHECK(s.empty());
+        }
+        for (std::size_t k = 0; k != buf.size(); ++k)
+        {
+            buf[k] = { int(k), std::to_string(k) };
+        }
+        CHECK(get<0>(buf[12]) == 12);
+        CHECK(get<1>(buf[12]) == "12");
+        CHECK(std::tuple<int, std::string>(buf[7]) == std::tuple<int, std::string>{ 7, "7" });
+
+        buf[0] = buf[12];
+        CHECK(get<1>(buf[0]) == "12");
+        swap(buf[0], buf[1]);
+        CHECK(get<0>(buf[0]) == 1);
+        CHECK(get<0>(buf[1]) == 12);
+
+        auto const& cbuf = buf;
+        CHECK(cbuf.end() - cbuf.begin() == 13);
+        mk::aosoa_buffer<8, int, std::string>::const_iterator it = buf.begin();
+        CHECK(get<1>(it[2]) == "2");
+
+            // Padding elements are value-initialized.
+        auto [i1, s1] = buf.tile(1);
+        CHECK(i1[7] == 0);
+        CHECK(s1[7].empty());
+    }
+    SECTION("sorting")
+    {
+        auto buf = mk::aosoa_buffer<4, int, char>(7);
+        for (std::size_t k = 0; k != buf.size(); ++k)
+        {
+            buf[k] = { int(7 - k), char('a' + k) };
+        }
+        std::sort(buf.begin(), buf.end(),
+            [](auto const& lhs, auto const& rhs)
+            {
+                return get<0>(lhs) < get<0>(rhs);
+            });
+        CHECK(get<0>(buf[0]) == 1);
+        CHECK(get<1>(buf[0]) == 'g');
+        CHECK(get<1>(buf[6]) == 'a');
+    }
+    SECTION("range_for() over tiles")
+    {
+        auto src = mk::aosoa_buffer<8, double, double>(20);
+        auto dst = mk::aosoa_buffer<8, double, double>(20);
+        for (std::size_t k = 0; k != src.size(); ++k)
+        {
+            src[k] = { double(k), 1. };
+        }
+        mk::range_for(
+            [](mk::soa_span<double, double> dstTile, mk::soa_span<double const, double const> srcTile)
+            {
+                auto [dx, dy] = dstTile;
+                auto [sx, sy] = srcTile;
+                for (gsl::index i = 0; i != sx.ssize(); ++i)
+                {
+                    dx[i] = sx[i] + sy[i];
+                    dy[i] = sx[i] - sy[i];
+                }
+            },
+            dst.tiles(), std::as_const(src).tiles());
+        CHECK(get<0>(dst[19]) == 20.);
+        CHECK(get<1>(dst[19]) == 18.);
+
+        auto [px, py] = dst.tile(2);
+        CHECK(px[7] == 0.);  // padding element: 0 + 0
+        CHECK(py[7] == 0.);
+
+        int numTiles = 0;
+        mk::range_for(
+            [&numTiles](gsl::index t, auto)
+            {
+                CHECK(t == numTiles);
+                ++numTiles;
+            },
+            mk::range_index, dst.tiles());
+        CHECK(numTiles == 3);
+    }
+    SECTION("copying and moving")
+    {
+        auto buf = mk::aosoa_buffer<2, int, std::string>(3);
+        buf[2] = { 2, "two" };
+        auto buf2 = buf;
+        CHECK(get<1>(buf2[2]) == "two");
+        CHECK(&get<1>(buf2[2]) != &get<1>(buf[2]));
+        auto data = &get<0>(buf[0]);
+        auto buf3 = std::move(buf);
+        CHECK(&get<0>(buf3[0]) == data);
+        CHECK(buf.empty());
+        buf = buf3;
+        CHECK(get<1>(buf[2]) == "two");
+        buf3 = mk::aosoa_buffer<2, int, std::string>{ };
+        CHECK(buf3.empty());
+        CHECK(buf3.tiles().empty());
+        using std::swap;
+        swap(buf, buf3);
+        CHECK(buf3.size() == 3);
+    }
+    SECTION("copy assignment leaves the buffer unchanged if copying throws")
+    {
+        auto buf = mk::aosoa_buffer<2, ThrowingCopy>(3);
+        get<0>(buf[0]).value = 42;
+        auto other = mk::aosoa_buffer<2, ThrowingCopy>(4);
+        get<0>(other[3]).throwOnCopy = true;
+        CHECK_THROWS_AS(buf = other, std::runtime_error);
+        CHECK(buf.size() == 3);
+        CHECK(get<0>(buf[0]).value == 42);
+    }
+    SECTION("allocators")
+    {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto buf = mk::pmr::aosoa_buffer<16, float, std::pmr::string>(40, &resource);
+        get<1>(buf[39]) = "a string which is too long for the small string optimization";
+        CHECK(buf.get_allocator().resource() == &resource);
+        CHECK(buf.num_tiles() == 3);
+
+            // `polymorphic_allocator<>` does not propagate on move assignment, so elements are moved to a block of the target's
+            // resource.
+        auto resource2 = std::pmr::monotonic_buffer_resource();
+        auto ptrs = mk::pmr::aosoa_buffer<4, std::unique_ptr<int>>(5, &resource);
+        get<0>(ptrs[4]) = std::make_unique<int>(4);
+        int* p4 = get<0>(ptrs[4]).get();
+        auto ptrs2 = mk::pmr::aosoa_buffer<4, std::unique_ptr<int>>(&resource2);
+        ptrs2 = std::move(ptrs);
+        CHECK(ptrs.empty());
+        CHECK(ptrs2.size() == 5);
+        CHECK(get<0>(ptrs2[4]).get() == p4);
+        CHECK(ptrs2.get_allocator().resource() == &resource2);
+    }
+}
+
+
+} // anonymous namespace
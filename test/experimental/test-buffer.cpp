@@ -1,18 +1,73 @@
 
 #include <makeshift/experimental/buffer.hpp>
+#include <makeshift/experimental/memory.hpp>
+#include <makeshift/experimental/span.hpp>
+#include <makeshift/algorithm.hpp>
 
-#include <type_traits> // for integral_constant<>
+#include <string>
+#include <vector>
+#include <memory>           // for allocator<>
+#include <cstddef>          // for size_t
+#include <utility>          // for move()
+#include <stdexcept>        // for runtime_error
+#include <type_traits>      // for integral_constant<>, is_same<>, is_nothrow_move_constructible<>
+#include <memory_resource>  // for pmr::monotonic_buffer_resource
 
 #include <gsl-lite/gsl-lite.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "test-alignment.hpp"  // for is_aligned()
+
 
 namespace {
 
 namespace mk = ::makeshift;
 namespace gsl = ::gsl_lite;
 
+using test::is_aligned;
+
+
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    std::size_t* numLiveElements;
+
+    explicit counting_allocator(std::size_t& _numLiveElements) noexcept : numLiveElements(&_numLiveElements) { }
+    template <typename U> counting_allocator(counting_allocator<U> const& rhs) noexcept : numLiveElements(rhs.numLiveElements) { }
+
+    T* allocate(std::size_t n)
+    {
+        *numLiveElements += n;
+        return std::allocator<T>{ }.allocate(n);
+    }
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        *numLiveElements -= n;
+        std::allocator<T>{ }.deallocate(ptr, n);
+    }
+
+    template <typename U> friend bool operator ==(counting_allocator const& lhs, counting_allocator<U> const& rhs) noexcept { return lhs.numLiveElements == rhs.numLiveElements; }
+    template <typename U> friend bool operator !=(counting_allocator const& lhs, counting_allocator<U> const& rhs) noexcept { return !(lhs == rhs); }
+};
+
+struct ThrowingCopy
+{
+    static inline bool throwOnCopy = false;
+
+    int value = 0;
+
+    ThrowingCopy(void) = default;
+    ThrowingCopy(ThrowingCopy const& rhs)
+        : value(rhs.value)
+    {
+        if (throwOnCopy) throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy& operator =(ThrowingCopy const&) = default;
+};
+
 
 TEST_CASE("buffer")
 {
@@ -29,5 +84,353 @@ TEST_CASE("buffer")
     buf7 = { 1, 4, 1, 4, 2, 1, 3 };
 }
 
+template <typename BufferT>
+bool
+is_padding_zero(BufferT const& buf)
+{
+    for (std::size_t i = buf.size(); i != buf.padded_size(); ++i)
+    {
+        if (buf.data()[i] != 0) return false;
+    }
+    return true;
+}
+
+
+TEST_CASE("aligned buffer")
+{
+    auto c5 = std::integral_constant<int, 5>{ };
+
+    SECTION("heap storage")
+    {
+        auto buf = mk::make_buffer<float, -1, 64>(5);
+        static_assert(std::is_same<decltype(buf), mk::buffer<float, mk::dynamic_extent, -1, std::allocator<float>, 64>>::value, "static assertion failed");
+        CHECK(is_aligned(buf.data(), 64));
+        CHECK(buf.size() == 5);
+        CHECK(buf.padded_size() == 16);
+        CHECK(buf.end() - buf.begin() == 5);
+
+        auto ubuf = mk::buffer<float, mk::dynamic_extent, -1, std::allocator<float>, 32>(17, mk::default_init);
+        CHECK(is_aligned(ubuf.data(), 32));
+        CHECK(ubuf.padded_size() == 24);
+        CHECK(is_padding_zero(ubuf));
+
+        auto bufCopy = ubuf;
+        CHECK(is_aligned(bufCopy.data(), 32));
+        auto bufMoved = std::move(bufCopy);
+        CHECK(is_aligned(bufMoved.data(), 32));
+        CHECK(bufMoved.size() == 17);
+    }
+    SECTION("in-place storage")
+    {
+        auto buf = mk::make_buffer<double, 16, 64>(c5);
+        CHECK(is_aligned(buf.data(), 64));
+        CHECK(buf.padded_size() == 8);
+        CHECK(buf.end() - buf.begin() == 5);
+        CHECK(is_padding_zero(buf));
+
+        auto sbuf = mk::buffer<double, mk::dynamic_extent, 16, std::allocator<double>, 32>(3, mk::default_init);
+        CHECK(is_aligned(sbuf.data(), 32));
+        CHECK(sbuf.padded_size() == 4);
+        CHECK(is_padding_zero(sbuf));
+        auto sbufMoved = std::move(sbuf);
+        CHECK(is_aligned(sbufMoved.data(), 32));
+        CHECK(is_padding_zero(sbufMoved));
+
+        auto fbuf = mk::make_fixed_buffer<double, 16, 64>(3);
+        CHECK(is_aligned(fbuf.data(), 64));
+        CHECK(fbuf.padded_size() == 8);
+        auto ufbuf = mk::fixed_buffer<double, mk::dynamic_extent, 16, 64>(3, mk::default_init);
+        CHECK(is_padding_zero(ufbuf));
+    }
+    SECTION("element sizes that do not divide the alignment")
+    {
+        struct rgb { char r, g, b; bool operator !=(int) const { return r != 0 || g != 0 || b != 0; } };
+        auto buf = mk::make_buffer<rgb, -1, 16>(20);
+        CHECK(is_aligned(buf.data(), 16));
+        CHECK(buf.padded_size() == 32);
+        CHECK(is_padding_zero(buf));
+    }
+    SECTION("allocator")
+    {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto buf = mk::pmr::buffer<float, mk::dynamic_extent, -1, 64>(3, &resource);
+        CHECK(is_aligned(buf.data(), 64));
+        auto arena = mk::monotonic_arena();
+        auto abuf = mk::make_buffer<float, -1, 128>(3, mk::arena_allocator<float>(arena));
+        CHECK(is_aligned(abuf.data(), 128));
+    }
+}
+
+TEST_CASE("buffer initialization and copying")
+{
+    SECTION("value initialization")
+    {
+        auto buf3 = mk::make_buffer<int, 4>(3);
+        CHECK((buf3[0] == 0 && buf3[1] == 0 && buf3[2] == 0));
+        auto buf7 = mk::make_buffer<int, 4>(7);
+        CHECK(buf7[6] == 0);
+    }
+    SECTION("default initialization")
+    {
+        auto buf = mk::buffer<double>(1000, mk::default_init);
+        CHECK(buf.size() == 1000);
+        buf[999] = 1.;
+        auto fbuf = mk::fixed_buffer<double, mk::dynamic_extent, 16>(10, mk::default_init);
+        CHECK(fbuf.size() == 10);
+        auto sbuf = mk::buffer<std::string, mk::dynamic_extent, 4>(10, mk::default_init);
+        CHECK(sbuf[9].empty());
+    }
+    SECTION("copy construction")
+    {
+        auto buf = mk::buffer<double>(100, mk::default_init);
+        for (std::size_t i = 0; i != buf.size(); ++i)
+        {
+            buf[i] = double(i);
+        }
+        auto bufCopy = buf;
+        CHECK(bufCopy.data() != buf.data());
+        CHECK(bufCopy[99] == 99.);
+
+        auto sbuf = mk::make_buffer<std::string, 2>(5);
+        sbuf[4] = "abc";
+        auto sbufCopy = sbuf;
+        CHECK(sbufCopy[4] == "abc");
+        auto sbuf1 = mk::make_buffer<std::string, 2>(1);
+        sbuf1[0] = "def";
+        auto sbuf1Copy = sbuf1;
+        CHECK(sbuf1Copy[0] == "def");
+    }
+}
+
+TEST_CASE("buffer copy and move")
+{
+    SECTION("moving steals heap storage")
+    {
+        static_assert(std::is_nothrow_move_constructible<mk::buffer<std::string>>::value, "static assertion failed");
+        auto buf = mk::make_buffer<std::string>(10);
+        buf[9] = "abc";
+        auto data = buf.data();
+        auto buf2 = std::move(buf);
+        CHECK(buf2.data() == data);
+        CHECK(buf2[9] == "abc");
+        CHECK(buf.empty());
+
+        auto buf3 = mk::make_buffer<std::string>(2);
+        buf3 = std::move(buf2);
+        CHECK(buf3.data() == data);
+        CHECK(buf3.size() == 10);
+    }
+    SECTION("moving in-place storage moves elements")
+    {
+        auto buf = mk::make_buffer<std::string, 4>(3);
+        buf[2] = "abc";
+        auto buf2 = std::move(buf);
+        CHECK(buf2.data() != buf.data());
+        CHECK(buf2.size() == 3);
+        CHECK(buf2[2] == "abc");
+
+        auto heapBuf = mk::make_buffer<std::string, 4>(7);
+        heapBuf = std::move(buf2);
+        CHECK(heapBuf.size() == 3);
+        CHECK(heapBuf[2] == "abc");
+    }
+    SECTION("copy assignment")
+    {
+        auto buf = mk::make_buffer<int, 4>(7);
+        buf[6] = 42;
+        auto buf2 = mk::make_buffer<int, 4>(2);
+        buf2 = buf;
+        CHECK(buf2.size() == 7);
+        CHECK(buf2[6] == 42);
+        CHECK(buf2.data() != buf.data());
+        auto& self = buf2;
+        buf2 = self;
+        CHECK(buf2[6] == 42);
+    }
+    SECTION("buffers can be stored in containers and returned from functions")
+    {
+        auto makeRow = [](int i) { auto row = mk::make_buffer<int>(100); row[0] = i; return row; };
+        auto rows = std::vector<mk::buffer<int>>{ };
+        for (int i = 0; i != 10; ++i)
+        {
+            rows.push_back(makeRow(i));
+        }
+        CHECK(rows[9][0] == 9);
+    }
+    SECTION("move assignment with unequal allocators which do not propagate")
+    {
+        auto resource1 = std::pmr::monotonic_buffer_resource();
+        auto resource2 = std::pmr::monotonic_buffer_resource();
+        auto buf1 = mk::pmr::buffer<std::string>(5, &resource1);
+        buf1[4] = "abc";
+        auto buf2 = mk::pmr::buffer<std::string>(1, &resource2);
+        buf2 = std::move(buf1);
+        CHECK(buf2.get_allocator().resource() == &resource2);
+        CHECK(buf2.data() != buf1.data());
+        CHECK(buf2[4] == "abc");
+    }
+}
+
+TEST_CASE("buffer with allocator")
+{
+    SECTION("heap storage is obtained from the allocator")
+    {
+        std::size_t numLiveElements = 0;
+        {
+            auto buf = mk::make_buffer<int>(7, counting_allocator<char>(numLiveElements));
+            static_assert(std::is_same<decltype(buf), mk::buffer<int, mk::dynamic_extent, -1, counting_allocator<int>>>::value, "static assertion failed");
+            CHECK(numLiveElements == 7);
+            CHECK(buf[6] == 0);
+            CHECK(buf.get_allocator() == counting_allocator<int>(numLiveElements));
+
+            auto buf2 = buf;
+            CHECK(numLiveElements == 14);
+        }
+        CHECK(numLiveElements == 0);
+    }
+    SECTION("in-place storage does not allocate")
+    {
+        std::size_t numLiveElements = 0;
+        auto buf3 = mk::make_buffer<int, 4>(3, counting_allocator<int>(numLiveElements));
+        auto buf5 = mk::make_buffer<int, 4>(5, counting_allocator<int>(numLiveElements));
+        CHECK(numLiveElements == 5);
+    }
+    SECTION("std::pmr")
+    {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto buf = mk::pmr::buffer<double>(100, &resource);
+        CHECK(buf.get_allocator().resource() == &resource);
+        buf[99] = 1.;
+    }
+    SECTION("arena and pool allocators")
+    {
+        auto arena = mk::monotonic_arena();
+        auto buf1 = mk::make_buffer<double>(100, mk::arena_allocator<double>(arena));
+        buf1[0] = 1.;
+        auto buf2 = mk::make_buffer<double, 8>(100, mk::pool_allocator<double>{ });
+        static_assert(sizeof(buf2) == sizeof(double*) + sizeof(std::size_t) + 8*sizeof(double), "empty allocators should not take up space");
+        CHECK(buf2[99] == 0.);
+    }
+}
+
+
+TEST_CASE("row_buffer")
+{
+    auto c3 = std::integral_constant<int, 3>{ };
+    auto c4 = std::integral_constant<int, 4>{ };
+
+    SECTION("static and dynamic extents")
+    {
+        auto A = mk::make_row_buffer<int>(c3, c4);
+        static_assert(std::is_same<decltype(A), mk::row_buffer<int, 3, 4>>::value, "static assertion failed");
+        CHECK(A.rows() == 3);
+        CHECK(A.cols() == 4);
+        CHECK(A.leading_dimension() == 4);
+
+        auto B = mk::make_row_buffer<int, 16>(2, c3);
+        static_assert(std::is_same<decltype(B), mk::row_buffer<int, mk::dynamic_extent, 3, 16>>::value, "static assertion failed");
+        auto C = mk::make_row_buffer<int>(5, 7);
+        CHECK(C.size() == 5);
+        CHECK(C.padded_size() == 35);
+        C(4, 6) = 42;
+        CHECK(C[4][6] == 42);
+        CHECK(C.row(4).size() == 7);
+        CHECK(C.elements()[34] == 42);
+    }
+    SECTION("padded leading dimension")
+    {
+        auto A = mk::make_row_buffer<float, -1, 32>(3, 5);
+        CHECK(A.leading_dimension() == 8);
+        CHECK(A.padded_size() == 24);
+        for (std::size_t i = 0; i != A.rows(); ++i)
+        {
+            CHECK(is_aligned(A.row(i).data(), 32));
+        }
+
+        auto B = mk::row_buffer<double, mk::dynamic_extent, mk::dynamic_extent, 64, std::allocator<double>, 32>(3, 3, mk::default_init);
+        CHECK(is_aligned(B.elements().data(), 32));
+        for (std::size_t i = 0; i != B.rows(); ++i)
+        {
+            CHECK(B.elements()[i*B.leading_dimension() + 3] == 0.);
+        }
+    }
+    SECTION("rows form a range")
+    {
+        auto A = mk::make_row_buffer<int, -1, 16>(4, c3);
+        int k = 0;
+        for (auto row : A)
+        {
+            for (int& a : row) a = k++;
+        }
+        CHECK(A(3, 2) == 11);
+        CHECK(A.end() - A.begin() == 4);
+
+        auto const& cA = A;
+        auto it = cA.begin();
+        it += 2;
+        CHECK((*it)[0] == 6);
+        CHECK(it[1][1] == 10);
+
+        auto empty = mk::make_row_buffer<int>(3, 0);
+        CHECK(empty.end() - empty.begin() == 3);
+    }
+    SECTION("range_for() and soa_span<>")
+    {
+        auto A = mk::make_row_buffer<double, -1, 32>(3, 5);
+        mk::range_for(
+            [](gsl::index i, gsl::span<double> row)
+            {
+                for (double& a : row) a = double(i);
+            },
+            mk::range_index, A);
+        for (auto&& [x, y] : mk::make_soa_span(A.row(0), A.row(2)))
+        {
+            x = 2*y;
+        }
+        CHECK(A(0, 4) == 4.);
+        CHECK(A(1, 4) == 1.);
+    }
+    SECTION("copying and moving")
+    {
+        auto A = mk::make_row_buffer<std::string>(2, 3);
+        A(1, 2) = "abc";
+        auto B = A;
+        CHECK(B(1, 2) == "abc");
+        auto C = std::move(A);
+        CHECK(C(1, 2) == "abc");
+        CHECK(A.empty());
+        A = C;
+        CHECK(A(1, 2) == "abc");
+
+            // Moving a buffer with static extents and heap storage leaves it without storage; it can be assigned to again.
+        auto D = mk::row_buffer<int, 3, 4, 0>(c3, c4);
+        D(2, 3) = 42;
+        auto E = std::move(D);
+        CHECK(E(2, 3) == 42);
+        D = E;
+        CHECK(D(2, 3) == 42);
+        CHECK(D.elements().size() == 12);
+    }
+    SECTION("copy assignment keeps the extents if copying throws")
+    {
+        auto A = mk::make_row_buffer<ThrowingCopy>(2, 3);
+        auto B = mk::make_row_buffer<ThrowingCopy>(1, 1);
+        ThrowingCopy::throwOnCopy = true;
+        CHECK_THROWS_AS(B = A, std::runtime_error);
+        ThrowingCopy::throwOnCopy = false;
+        CHECK(B.rows() == 1);
+        CHECK(B.cols() == 1);
+        CHECK(B.elements().size() == 1);
+    }
+    SECTION("allocator")
+    {
+        std::size_t numLiveElements = 0;
+        {
+            auto A = mk::make_row_buffer<double, -1, 32>(10, 3, counting_allocator<double>(numLiveElements));
+            CHECK(numLiveElements != 0);
+        }
+        CHECK(numLiveElements == 0);
+    }
+}
 
 } // anonymous namespace
@@ -1,5 +1,16 @@
 
 #include <makeshift/experimental/functional.hpp>
+#include <makeshift/tuple.hpp>  // for value_tuple<>
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>  // for int16_t, int32_t, int64_t
+#include <cstring>  // for memset()
+#include <optional>
+#include <algorithm>  // for sort(), is_sorted()
+#include <unordered_map>
+#include <unordered_set>
 
 #include <gsl-lite/gsl-lite.hpp>
 
@@ -12,7 +23,210 @@ namespace mk = ::makeshift;
 namespace gsl = ::gsl_lite;
 
 
-// TODO: add tests
+enum class Kind : std::int16_t { a, b };
+
+struct Key
+{
+    std::int32_t i, j;
+    friend bool operator ==(Key const& lhs, Key const& rhs) { return lhs.i == rhs.i && lhs.j == rhs.j; }
+};
+constexpr auto
+reflect(gsl::type_identity<Key>)
+{
+    return mk::value_tuple{ &Key::i, &Key::j };
+}
+
+struct Cell : Key
+{
+    std::array<std::int32_t, 2> extent;
+};
+constexpr auto
+reflect(gsl::type_identity<Cell>)
+{
+    return mk::value_tuple{
+        mk::value_tuple{ gsl::type_identity<Key>{ } },
+        mk::value_tuple{ &Cell::extent }
+    };
+}
+
+struct Padded { std::int32_t i; std::int64_t j; };
+constexpr auto
+reflect(gsl::type_identity<Padded>)
+{
+    return mk::value_tuple{ &Padded::i, &Padded::j };
+}
+
+struct PartiallyReflected { std::int32_t i, j; };
+constexpr auto
+reflect(gsl::type_identity<PartiallyReflected>)
+{
+    return mk::value_tuple{ &PartiallyReflected::i };
+}
+
+struct SortKey
+{
+    std::int16_t a;
+    Kind kind;
+    double v;
+    std::array<std::uint8_t, 2> tag;
+    bool flag;
+};
+constexpr auto
+reflect(gsl::type_identity<SortKey>)
+{
+    return mk::value_tuple{ &SortKey::a, &SortKey::kind, &SortKey::v, &SortKey::tag, &SortKey::flag };
+}
+
+struct Record
+{
+    std::string name;
+    double weight;
+    Kind kind;
+    std::vector<Key> keys;
+    std::optional<int> id;
+};
+constexpr auto
+reflect(gsl::type_identity<Record>)
+{
+    return mk::value_tuple{ &Record::name, &Record::weight, &Record::kind, &Record::keys, &Record::id };
+}
+
+
+TEST_CASE("reflected_hash<>")
+{
+    static_assert(mk::reflected_hash<Key>::is_trivially_hashable);
+    static_assert(mk::reflected_hash<Cell>::is_trivially_hashable);
+    static_assert(!mk::reflected_hash<Padded>::is_trivially_hashable);
+    static_assert(!mk::reflected_hash<PartiallyReflected>::is_trivially_hashable);
+    static_assert(!mk::reflected_hash<Record>::is_trivially_hashable);
+
+    SECTION("equal values have equal hashes")
+    {
+        auto hash = mk::reflected_hash<Record>{ };
+        auto r1 = Record{ "abc", 0., Kind::b, { { 1, 2 }, { 3, 4 } }, 42 };
+        auto r2 = Record{ std::string("ab") + "c", -0., Kind::b, { { 1, 2 }, { 3, 4 } }, 42 };
+        CHECK(hash(r1) == hash(r2));
+        r2.keys.pop_back();
+        CHECK(hash(r1) != hash(r2));
+        r2 = r1;
+        r2.id.reset();
+        CHECK(hash(r1) != hash(r2));
+
+        auto p1 = Padded{ };
+        auto p2 = Padded{ };
+        std::memset(&p2, 0xFF, sizeof p2);
+        p2.i = 0;
+        p2.j = 0;
+        CHECK(mk::reflected_hash<Padded>{ }(p1) == mk::reflected_hash<Padded>{ }(p2));
+
+        CHECK(mk::reflected_hash<PartiallyReflected>{ }({ 1, 2 }) == mk::reflected_hash<PartiallyReflected>{ }({ 1, 3 }));
+    }
+    SECTION("distinct values")
+    {
+        auto hashes = std::unordered_set<std::size_t>{ };
+        for (std::int32_t i = 0; i != 64; ++i)
+        {
+            for (std::int32_t j = 0; j != 64; ++j)
+            {
+                hashes.insert(mk::reflected_hash<Key>{ }(Key{ i, j }));
+                hashes.insert(mk::reflected_hash<Cell>{ }(Cell{ { i, j }, { 1, 1 } }));
+            }
+        }
+        CHECK(hashes.size() == 2*64*64);
+    }
+    SECTION("unordered_map<>")
+    {
+        auto map = std::unordered_map<Key, int, mk::reflected_hash<Key>>{ };
+        map[{ 1, 2 }] = 3;
+        map[{ 2, 1 }] = 4;
+        CHECK(map.at({ 1, 2 }) == 3);
+        CHECK(map.at({ 2, 1 }) == 4);
+        CHECK(map.count({ 1, 1 }) == 0);
+    }
+}
+
+TEST_CASE("reflected_equal<>")
+{
+    static_assert(mk::reflected_equal<Key>::is_bitwise_comparable);
+    static_assert(!mk::reflected_equal<Padded>::is_bitwise_comparable);
+    static_assert(!mk::reflected_equal<Record>::is_bitwise_comparable);
+
+    auto eq = mk::reflected_equal<Cell>{ };
+    CHECK(eq(Cell{ { 1, 2 }, { 3, 4 } }, Cell{ { 1, 2 }, { 3, 4 } }));
+    CHECK_FALSE(eq(Cell{ { 1, 2 }, { 3, 4 } }, Cell{ { 1, 2 }, { 3, 5 } }));
+
+    auto p1 = Padded{ };
+    auto p2 = Padded{ };
+    std::memset(&p2, 0xFF, sizeof p2);
+    p2.i = 0;
+    p2.j = 0;
+    CHECK(mk::reflected_equal<Padded>{ }(p1, p2));
+
+    auto r1 = Record{ "abc", 0., Kind::b, { { 1, 2 } }, std::nullopt };
+    auto r2 = Record{ "abc", -0., Kind::b, { { 1, 2 } }, std::nullopt };
+    CHECK(mk::reflected_equal<Record>{ }(r1, r2));
+    r2.id = 1;
+    CHECK_FALSE(mk::reflected_equal<Record>{ }(r1, r2));
+
+    auto map = std::unordered_map<Padded, int, mk::reflected_hash<Padded>, mk::reflected_equal<Padded>>{ };
+    map[p1] = 1;
+    CHECK(map.at(p2) == 1);
+}
+
+TEST_CASE("reflected_less<>")
+{
+    auto less = mk::reflected_less<Record>{ };
+    auto r1 = Record{ "abc", 1., Kind::a, { { 1, 2 } }, std::nullopt };
+    auto r2 = r1;
+    CHECK_FALSE(less(r1, r2));
+    r2.id = 0;
+    CHECK(less(r1, r2));
+    CHECK_FALSE(less(r2, r1));
+    r2.name = "abb";
+    CHECK(less(r2, r1));
+    r2 = r1;
+    r2.keys[0].j = 3;
+    CHECK(less(r1, r2));
+    r2.weight = 0.5;
+    CHECK(less(r2, r1));
+}
+
+TEST_CASE("make_sort_key()")
+{
+    static_assert(mk::sort_key_size<SortKey>() == 2 + 2 + 8 + 2 + 1);
+    static_assert(mk::sort_key_size<Cell>() == 16);
+
+    auto key = mk::make_sort_key(Key{ -1, 0x01020304 });
+    auto expected = std::array<std::byte, 8>{
+        std::byte(0x7F), std::byte(0xFF), std::byte(0xFF), std::byte(0xFF),
+        std::byte(0x81), std::byte(0x02), std::byte(0x03), std::byte(0x04) };
+    CHECK(key == expected);
+
+        // Sort keys are ordered like the values.
+    auto values = std::vector<SortKey>{ };
+    for (std::int16_t a : { std::int16_t(-300), std::int16_t(-1), std::int16_t(0), std::int16_t(2) })
+    {
+        for (Kind kind : { Kind::a, Kind::b })
+        {
+            for (double v : { -1.e10, -2.5, -1.e-300, 0., 1.e-300, 3., 1.e300 })
+            {
+                for (std::uint8_t t : { 0, 200 })
+                {
+                    values.push_back(SortKey{ a, kind, v, { t, std::uint8_t(255 - t) }, t == 0 });
+                }
+            }
+        }
+    }
+    std::reverse(values.begin(), values.end());
+    auto less = mk::reflected_less<SortKey>{ };
+    CHECK_FALSE(std::is_sorted(values.begin(), values.end(), less));
+    std::sort(values.begin(), values.end(),
+        [](SortKey const& lhs, SortKey const& rhs)
+        {
+            return mk::make_sort_key(lhs) < mk::make_sort_key(rhs);
+        });
+    CHECK(std::is_sorted(values.begin(), values.end(), less));
+}
 
 
 } // anonymous namespace
@@ -0,0 +1,298 @@
+
+#include <makeshift/experimental/json.hpp>
+#include <makeshift/tuple.hpp>  // for value_tuple<>
+
+#include <array>
+#include <cmath>     // for nan()
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>   // for int64_t
+#include <sstream>
+#include <utility>   // for pair<>
+#include <optional>
+#include <stdexcept>  // for runtime_error
+#include <string_view>
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, gsl_DEFINE_ENUM_BITMASK_OPERATORS()
+
+#include <catch2/catch_test_macros.hpp>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+enum class Color { red, green };
+constexpr auto
+reflect(gsl::type_identity<Color>)
+{
+    return std::array{
+        std::pair{ Color::red, "red" },
+        std::pair{ Color::green, "green" }
+    };
+}
+
+enum class Vegetables
+{
+    none     = 0,
+    tomato   = 0b0001,
+    onion    = 0b0010,
+    eggplant = 0b0100
+};
+gsl_DEFINE_ENUM_BITMASK_OPERATORS(Vegetables)
+constexpr auto
+reflect(gsl::type_identity<Vegetables>)
+{
+    return std::array{
+        std::pair{ Vegetables::none, "none" },
+        std::pair{ Vegetables::tomato, "tomato" },
+        std::pair{ Vegetables::onion, "onion" },
+        std::pair{ Vegetables::eggplant, "eggplant" }
+    };
+}
+
+enum class Unreflected { a = 3 };
+
+struct Pixel
+{
+    int x, y;
+    Color color;
+};
+constexpr auto
+reflect(gsl::type_identity<Pixel>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &Pixel::x, "x" },
+        mk::value_tuple{ &Pixel::y, "y" },
+        mk::value_tuple{ &Pixel::color, "color" });
+}
+
+struct Sprite : Pixel
+{
+    std::string name;
+    Vegetables toppings;
+    std::vector<double> weights;
+    std::array<bool, 2> visible;
+    std::optional<std::int64_t> id;
+    Unreflected tag;
+};
+constexpr auto
+reflect(gsl::type_identity<Sprite>)
+{
+    return mk::value_tuple{
+        mk::value_tuple{ gsl::type_identity<Pixel>{ } },
+        mk::make_value_tuple(
+            mk::value_tuple{ &Sprite::name, "name" },
+            mk::value_tuple{ &Sprite::toppings, "toppings" },
+            mk::value_tuple{ &Sprite::weights, "weights" },
+            mk::value_tuple{ &Sprite::visible, "visible" },
+            mk::value_tuple{ &Sprite::id, "id" },
+            mk::value_tuple{ &Sprite::tag, "tag" })
+    };
+}
+
+struct Config
+{
+    Sprite sprite;
+    double scale = 1.;
+    std::array<int, 3> dims = { };
+};
+constexpr auto
+reflect(gsl::type_identity<Config>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &Config::sprite, "sprite" },
+        mk::value_tuple{ &Config::scale, "scale" },
+        mk::value_tuple{ &Config::dims, "dims" });
+}
+
+struct Quoted { int value; };
+constexpr auto
+reflect(gsl::type_identity<Quoted>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &Quoted::value, "a \"quoted\"\tkey" });
+}
+
+struct Label
+{
+    char text[8];
+    int id;
+};
+constexpr auto
+reflect(gsl::type_identity<Label>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &Label::text, "text" },
+        mk::value_tuple{ &Label::id, "id" });
+}
+
+
+TEST_CASE("to_json()")
+{
+    SECTION("scalars")
+    {
+        CHECK(mk::to_json_string(true) == "true");
+        CHECK(mk::to_json_string(-42) == "-42");
+        CHECK(mk::to_json_string(0.5) == "0.5");
+        CHECK(mk::to_json_string(std::numeric_limits<double>::infinity()) == "null");
+        CHECK(mk::to_json_string(std::nan("")) == "null");
+        CHECK(mk::to_json_string(Color::green) == "\"green\"");
+        CHECK(mk::to_json_string(Vegetables::tomato | Vegetables::eggplant) == "\"tomato+eggplant\"");
+        CHECK(mk::to_json_string(Vegetables::none) == "\"none\"");
+        CHECK(mk::to_json_string(Unreflected::a) == "3");
+        CHECK(mk::to_json_string(std::optional<int>{ }) == "null");
+    }
+    SECTION("strings are escaped")
+    {
+        CHECK(mk::to_json_string(std::string("a\"b\\c\nd\x01")) == "\"a\\\"b\\\\c\\nd\\u0001\"");
+        CHECK(mk::to_json_string(Quoted{ 1 }) == "{\"a \\\"quoted\\\"\\tkey\":1}");
+    }
+    SECTION("objects")
+    {
+        auto sprite = Sprite{ };
+        static_cast<Pixel&>(sprite) = { 1, 2, Color::green };
+        sprite.name = "hero";
+        sprite.toppings = Vegetables::onion;
+        sprite.weights = { 1.5, -2 };
+        sprite.visible = { true, false };
+        sprite.id = 7;
+        sprite.tag = Unreflected::a;
+
+        auto expected = std::string(
+            "{\"x\":1,\"y\":2,\"color\":\"green\",\"name\":\"hero\",\"toppings\":\"onion\",\"weights\":[1.5,-2],"
+            "\"visible\":[true,false],\"id\":7,\"tag\":3}");
+        CHECK(mk::to_json_string(sprite) == expected);
+
+        auto str = std::string("[");
+        mk::to_json(str, Pixel{ 3, 4, Color::red });
+        CHECK(str == "[{\"x\":3,\"y\":4,\"color\":\"red\"}");
+
+        auto chars = std::vector<char>{ };
+        mk::to_json(chars, sprite);
+        CHECK(std::string(chars.begin(), chars.end()) == expected);
+
+        auto sstr = std::ostringstream{ };
+        mk::to_json(sstr, std::vector<Pixel>{ { 1, 2, Color::red }, { 3, 4, Color::green } });
+        CHECK(sstr.str() == "[{\"x\":1,\"y\":2,\"color\":\"red\"},{\"x\":3,\"y\":4,\"color\":\"green\"}]");
+    }
+}
+
+TEST_CASE("from_json()")
+{
+    SECTION("round trip")
+    {
+        auto sprite = Sprite{ };
+        static_cast<Pixel&>(sprite) = { -1, 2, Color::green };
+        sprite.name = "a \"quoted\"\tname";
+        sprite.toppings = Vegetables::onion | Vegetables::tomato;
+        sprite.weights = { 1.5, -2, 1.e-300 };
+        sprite.visible = { false, true };
+        sprite.id = -7;
+        sprite.tag = Unreflected::a;
+
+        auto sprite2 = mk::from_json<Sprite>(mk::to_json_string(sprite));
+        CHECK(sprite2.x == -1);
+        CHECK(sprite2.y == 2);
+        CHECK(sprite2.color == Color::green);
+        CHECK(sprite2.name == sprite.name);
+        CHECK(sprite2.toppings == sprite.toppings);
+        CHECK(sprite2.weights == sprite.weights);
+        CHECK(sprite2.visible == sprite.visible);
+        CHECK(sprite2.id == sprite.id);
+        CHECK(sprite2.tag == Unreflected::a);
+    }
+    SECTION("members in any order, unknown members skipped")
+    {
+        auto pixel = Pixel{ 9, 9, Color::red };
+        mk::from_json(pixel, R"( { "color" : "green", "unknown": { "a": [1, "}", null, true] }, "y": -3 } )");
+        CHECK(pixel.x == 9);
+        CHECK(pixel.y == -3);
+        CHECK(pixel.color == Color::green);
+
+        auto config = mk::from_json<Config>(R"({ "dims": [1, 2, 3], "sprite": { "id": null, "name": "\u00e9\ud83d\ude00" } })");
+        CHECK(config.dims == std::array<int, 3>{ 1, 2, 3 });
+        CHECK(!config.sprite.id.has_value());
+        CHECK(config.sprite.name == "\xC3\xA9\xF0\x9F\x98\x80");
+        CHECK(mk::from_json<Quoted>(R"({"a \"quoted\"\tkey": 4})").value == 4);
+    }
+    SECTION("char arrays")
+    {
+        auto label = Label{ "abc", 1 };
+        CHECK(mk::to_json_string(label) == R"({"text":"abc","id":1})");
+        auto label2 = mk::from_json<Label>(mk::to_json_string(label));
+        CHECK(std::string_view(label2.text) == "abc");
+        CHECK(label2.id == 1);
+
+        auto full = Label{ { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h' }, 2 };
+        CHECK(mk::to_json_string(full) == R"({"text":"abcdefgh","id":2})");
+        auto full2 = mk::from_json<Label>(mk::to_json_string(full));
+        CHECK(std::string_view(full2.text, 8) == "abcdefgh");
+
+        CHECK_THROWS_AS(mk::from_json<Label>(R"({ "text": "abcdefghi" })"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<Label>(R"({ "text": ["a"] })"), std::runtime_error);
+    }
+    SECTION("nesting depth")
+    {
+        auto pixel = Pixel{ };
+        auto nested = std::string(100, '[') + std::string(100, ']');
+        mk::from_json(pixel, "{ \"unknown\": " + nested + ", \"x\": 1 }");
+        CHECK(pixel.x == 1);
+
+        auto deep = std::string(200000, '[') + std::string(200000, ']');
+        CHECK_THROWS_AS(mk::from_json(pixel, "{ \"unknown\": " + deep + " }"), std::runtime_error);
+    }
+    SECTION("errors")
+    {
+        CHECK_THROWS_AS(mk::from_json<Pixel>(R"({ "x": 1, })"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<Pixel>(R"({ "x": "1" })"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<Pixel>(R"({ "x": 1.5 })"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<Pixel>(R"({ "color": "blue" })"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<Pixel>(R"({ "x": 1 } 2)"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<Config>(R"({ "dims": [1, 2] })"), std::runtime_error);
+        CHECK_THROWS_AS(mk::from_json<std::string>(R"("abc)"), std::runtime_error);
+    }
+}
+
+TEST_CASE("from_kv()")
+{
+    auto text = std::string_view(
+        "# sprite settings\n"
+        "sprite.name = hero\n"
+        "\n"
+        "sprite.x=3\n"
+        "  sprite.color = green  \n"
+        "sprite.toppings = tomato+eggplant\n"
+        "sprite.weights = 0.5, 2\n"
+        "sprite.visible = true, false\n"
+        "sprite.id = 12\n"
+        "dims = 4, 5, 6\n"
+        "scale = 2.5");
+    auto config = mk::from_kv<Config>(text);
+    CHECK(config.sprite.name == "hero");
+    CHECK(config.sprite.x == 3);
+    CHECK(config.sprite.color == Color::green);
+    CHECK(config.sprite.toppings == (Vegetables::tomato | Vegetables::eggplant));
+    CHECK(config.sprite.weights == std::vector<double>{ 0.5, 2 });
+    CHECK(config.sprite.visible == std::array<bool, 2>{ true, false });
+    CHECK(config.sprite.id == 12);
+    CHECK(config.dims == std::array<int, 3>{ 4, 5, 6 });
+    CHECK(config.scale == 2.5);
+
+    mk::from_kv(config, "sprite.id =");
+    CHECK(!config.sprite.id.has_value());
+
+    CHECK_THROWS_AS(mk::from_kv(config, "scale"), std::runtime_error);
+    CHECK_THROWS_AS(mk::from_kv(config, "scales = 1"), std::runtime_error);
+    CHECK_THROWS_AS(mk::from_kv(config, "sprite = 1"), std::runtime_error);
+    CHECK_THROWS_AS(mk::from_kv(config, "scale.x = 1"), std::runtime_error);
+    CHECK_THROWS_AS(mk::from_kv(config, "scale = x"), std::runtime_error);
+    CHECK_THROWS_AS(mk::from_kv(config, "dims = 1, 2"), std::runtime_error);
+    CHECK_THROWS_AS(mk::from_kv(config, "sprite.color = blue"), std::runtime_error);
+}
+
+
+} // anonymous namespace
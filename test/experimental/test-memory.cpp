@@ -0,0 +1,133 @@
+
+#include <thread>
+#include <vector>
+#include <cstddef>  // for size_t, byte
+
+#include <makeshift/experimental/memory.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "test-alignment.hpp"  // for is_aligned()
+
+
+namespace {
+
+namespace mk = ::makeshift;
+
+using test::is_aligned;
+
+
+struct alignas(64) cache_line
+{
+    std::byte data[64];
+};
+
+
+TEST_CASE("monotonic_arena")
+{
+    SECTION("allocations are aligned and disjoint")
+    {
+        auto arena = mk::monotonic_arena(256);
+        auto p1 = static_cast<std::byte*>(arena.allocate(3, 1));
+        auto p2 = static_cast<std::byte*>(arena.allocate(8, 8));
+        auto p3 = static_cast<std::byte*>(arena.allocate(100, 64));
+        CHECK(is_aligned(p2, 8));
+        CHECK(is_aligned(p3, 64));
+        CHECK(p2 >= p1 + 3);
+        CHECK(p3 >= p2 + 8);
+    }
+    SECTION("grows beyond the initial block")
+    {
+        auto arena = mk::monotonic_arena(64);
+        auto p1 = arena.allocate(48);
+        auto p2 = arena.allocate(1000, 128);
+        CHECK(p1 != p2);
+        CHECK(is_aligned(p2, 128));
+    }
+    SECTION("reset() reuses the largest block")
+    {
+        auto arena = mk::monotonic_arena(64);
+        (void) arena.allocate(48);
+        auto p1 = arena.allocate(1000);
+        arena.reset();
+        auto p2 = arena.allocate(1000);
+        CHECK(p1 == p2);
+    }
+    SECTION("initial buffer")
+    {
+        alignas(16) std::byte storage[128];
+        auto arena = mk::monotonic_arena(storage, sizeof storage);
+        auto p1 = static_cast<std::byte*>(arena.allocate(64));
+        CHECK(p1 == storage);
+        auto p2 = static_cast<std::byte*>(arena.allocate(128));
+        CHECK((p2 < storage || p2 >= storage + sizeof storage));
+        arena.release();
+        CHECK(arena.allocate(16) == storage);
+    }
+}
+
+TEST_CASE("arena_allocator<>")
+{
+    auto arena = mk::monotonic_arena(64);
+    auto alloc = mk::arena_allocator<int>(arena);
+    auto v = std::vector<int, mk::arena_allocator<int>>(alloc);
+    for (int i = 0; i != 100; ++i)
+    {
+        v.push_back(i);
+    }
+    CHECK(v.size() == 100);
+    CHECK(v[99] == 99);
+
+    auto lineAlloc = mk::arena_allocator<cache_line>(alloc);
+    CHECK(lineAlloc == alloc);
+    CHECK(&lineAlloc.arena() == &arena);
+    CHECK(is_aligned(lineAlloc.allocate(3), 64));
+
+    auto otherArena = mk::monotonic_arena();
+    CHECK(mk::arena_allocator<int>(otherArena) != alloc);
+}
+
+TEST_CASE("pool_allocator<>")
+{
+    SECTION("released blocks are recycled")
+    {
+        auto alloc = mk::pool_allocator<double>{ };
+        double* p1 = alloc.allocate(100);
+        alloc.deallocate(p1, 100);
+        double* p2 = alloc.allocate(90);  // same size class
+        CHECK(p1 == p2);
+        alloc.deallocate(p2, 90);
+    }
+    SECTION("large and over-aligned requests")
+    {
+        auto alloc = mk::pool_allocator<char>{ };
+        char* p = alloc.allocate(100000);
+        p[99999] = 'x';
+        alloc.deallocate(p, 100000);
+
+        auto lineAlloc = mk::pool_allocator<cache_line>(alloc);
+        cache_line* q = lineAlloc.allocate(2);
+        CHECK(is_aligned(q, 64));
+        lineAlloc.deallocate(q, 2);
+    }
+    SECTION("cross-thread deallocation")
+    {
+        auto alloc = mk::pool_allocator<int>{ };
+        auto ptrs = std::vector<int*>{ };
+        for (int i = 0; i != 200; ++i)
+        {
+            ptrs.push_back(alloc.allocate(std::size_t(i % 50) + 1));
+        }
+        auto thread = std::thread([&]
+        {
+            for (int i = 0; i != 200; ++i)
+            {
+                alloc.deallocate(ptrs[i], std::size_t(i % 50) + 1);
+            }
+        });
+        thread.join();
+    }
+}
+
+
+} // anonymous namespace
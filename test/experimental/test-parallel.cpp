@@ -0,0 +1,117 @@
+
+#include <tuple>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>  // for runtime_error
+#include <type_traits>
+
+#include <makeshift/tuple.hpp>  // for tuple_index
+#include <makeshift/experimental/parallel.hpp>
+
+#include <gsl-lite/gsl-lite.hpp> // for index
+
+#include <catch2/catch_test_macros.hpp>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+TEST_CASE("template_for_parallel()")
+{
+    SECTION("calls the procedure for every element")
+    {
+        auto values = std::tuple{ 1, 2.5, std::string("abc") };
+        auto doubled = std::tuple<int, double, std::string>{ };
+        mk::template_for_parallel(
+            [](auto const& value, auto& result) { result = value + value; },
+            values, doubled);
+        CHECK(doubled == std::tuple{ 2, 5., std::string("abcabc") });
+    }
+    SECTION("explicit size")
+    {
+        auto counts = std::vector<int>(16);
+        mk::template_for_parallel<16>(
+            [&](gsl::index i) { ++counts[i]; },
+            mk::range_index);
+        CHECK(counts == std::vector<int>(16, 1));
+    }
+    SECTION("nested invocation")
+    {
+        auto sum = std::atomic<int>(0);
+        mk::template_for_parallel<4>(
+            [&](gsl::index)
+            {
+                mk::template_for_parallel<4>(
+                    [&](gsl::index j) { sum += int(j); },
+                    mk::range_index);
+            },
+            mk::range_index);
+        CHECK(sum == 4*(0 + 1 + 2 + 3));
+    }
+    SECTION("waits for long-running tasks")
+    {
+        auto finished = std::vector<int>(4);
+        mk::template_for_parallel<4>(
+            [&](gsl::index i)
+            {
+                if (i != 0) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                finished[i] = 1;
+            },
+            mk::range_index);
+        CHECK(finished == std::vector<int>(4, 1));
+    }
+    SECTION("exceptions are propagated")
+    {
+        auto numCalls = std::atomic<int>(0);
+        CHECK_THROWS_WITH(
+            mk::template_for_parallel<8>(
+                [&](gsl::index i)
+                {
+                    ++numCalls;
+                    if (i == 3 || i == 5) throw std::runtime_error("element " + std::to_string(i));
+                },
+                mk::range_index),
+            "element 3");
+        CHECK(numCalls == 8);
+    }
+}
+
+TEST_CASE("tuple_transform_parallel()")
+{
+    SECTION("results are returned in element order")
+    {
+        auto squares = mk::tuple_transform_parallel(
+            [](auto x) { return x*x; },
+            std::tuple{ 2, 3.f, 4. });
+        static_assert(std::is_same<decltype(squares), std::tuple<int, float, double>>::value, "static assertion failed");
+        CHECK(squares == std::tuple{ 4, 9.f, 16. });
+    }
+    SECTION("explicit size")
+    {
+        auto indices = mk::tuple_transform_parallel<3>(
+            [](auto idxC) { return std::string(std::size_t(idxC()), 'x'); },
+            mk::tuple_index);
+        CHECK(indices == std::tuple{ std::string(""), std::string("x"), std::string("xx") });
+    }
+    SECTION("exceptions are propagated")
+    {
+        CHECK_THROWS_AS(
+            mk::tuple_transform_parallel<4>(
+                [](gsl::index i) -> int
+                {
+                    if (i == 2) throw std::runtime_error("error");
+                    return int(i);
+                },
+                mk::range_index),
+            std::runtime_error);
+    }
+}
+
+
+} // anonymous namespace
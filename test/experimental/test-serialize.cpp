@@ -0,0 +1,322 @@
+
+#include <makeshift/experimental/serialize.hpp>
+#include <makeshift/tuple.hpp>     // for value_tuple<>
+#include <makeshift/constval.hpp>  // for MAKESHIFT_CONSTVAL()
+
+#include <array>
+#include <vector>
+#include <cstddef>    // for byte
+#include <cstdint>    // for int16_t, int32_t, uint8_t, uint32_t
+#include <stdexcept>  // for runtime_error
+#include <string_view>
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>, span<>
+
+#include <catch2/catch_test_macros.hpp>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+enum class Kind : std::int16_t { a = 1, b = 0x0102 };
+
+struct Header
+{
+    std::uint32_t magic;
+    Kind kind;
+    bool valid;
+};
+constexpr auto
+reflect(gsl::type_identity<Header>)
+{
+    return mk::value_tuple{ &Header::magic, &Header::kind, &Header::valid };
+}
+
+struct Vec3 { float x, y, z; };
+constexpr auto
+reflect(gsl::type_identity<Vec3>)
+{
+    return mk::value_tuple{ &Vec3::x, &Vec3::y, &Vec3::z };
+}
+
+struct Particle : Header
+{
+    Vec3 position;
+    double mass;
+    std::array<std::int32_t, 2> cell;
+    std::uint8_t flags[3];
+};
+constexpr auto
+reflect(gsl::type_identity<Particle>)
+{
+    return mk::value_tuple{
+        mk::value_tuple{ gsl::type_identity<Header>{ } },
+        mk::value_tuple{ &Particle::position, &Particle::mass, &Particle::cell, &Particle::flags }
+    };
+}
+
+struct COO { std::int32_t i; std::int32_t j; double v; };
+constexpr auto
+reflect(gsl::type_identity<COO>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &COO::i, "i" },
+        mk::value_tuple{ &COO::j, "j" },
+        mk::value_tuple{ &COO::v, "v" });
+}
+
+struct AltLayoutCOO { std::int32_t i; std::int32_t j; double v; };
+constexpr auto
+reflect(gsl::type_identity<AltLayoutCOO>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &AltLayoutCOO::v, "v" },
+        mk::value_tuple{ &AltLayoutCOO::i, "i" },
+        mk::value_tuple{ &AltLayoutCOO::j, "j" });
+}
+
+struct PaddedCOO { std::int32_t i; double v; };
+constexpr auto
+reflect(gsl::type_identity<PaddedCOO>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &PaddedCOO::i, "i" },
+        mk::value_tuple{ &PaddedCOO::v, "v" });
+}
+
+struct InitializedCOO
+{
+    std::int32_t i;
+    std::int32_t j;
+    double v;
+
+    InitializedCOO(void) : i(-1), j(-1), v(0.) { }
+    InitializedCOO(std::int32_t _i, std::int32_t _j, double _v) : i(_i), j(_j), v(_v) { }
+};
+constexpr auto
+reflect(gsl::type_identity<InitializedCOO>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &InitializedCOO::i, "i" },
+        mk::value_tuple{ &InitializedCOO::j, "j" },
+        mk::value_tuple{ &InitializedCOO::v, "v" });
+}
+
+
+TEST_CASE("serialize_binary")
+{
+    SECTION("encoding is little-endian with fixed layout")
+    {
+        static_assert(mk::binary_size<Header>() == 4 + 2 + 1);
+        static_assert(mk::binary_size<Vec3>() == 12);
+        static_assert(mk::binary_size<Particle>() == 7 + 12 + 8 + 8 + 3);
+
+        auto header = Header{ 0x11223344u, Kind::b, true };
+        auto bytes = std::array<std::byte, 7>{ };
+        CHECK(mk::serialize_binary(header, bytes) == 7);
+        auto expected = std::array<std::byte, 7>{
+            std::byte(0x44), std::byte(0x33), std::byte(0x22), std::byte(0x11),
+            std::byte(0x02), std::byte(0x01),
+            std::byte(0x01) };
+        CHECK(bytes == expected);
+
+        auto header2 = mk::deserialize_binary<Header>(bytes);
+        CHECK(header2.magic == header.magic);
+        CHECK(header2.kind == Kind::b);
+        CHECK(header2.valid);
+    }
+    SECTION("round trip")
+    {
+        auto particles = std::vector<Particle>(3);
+        for (int i = 0; i != 3; ++i)
+        {
+            auto& p = particles[i];
+            p.magic = 42;
+            p.kind = Kind::a;
+            p.valid = i % 2 == 0;
+            p.position = { float(i), -float(i), 0.5f };
+            p.mass = 1.5*i;
+            p.cell = { i, -i };
+            p.flags[0] = std::uint8_t(i);
+            p.flags[1] = 0;
+            p.flags[2] = 0xFF;
+        }
+
+        constexpr std::size_t size = mk::binary_size<Particle>();
+        auto bytes = std::vector<std::byte>(particles.size()*size);
+        auto pos = gsl::span<std::byte>(bytes);
+        for (auto const& p : particles)
+        {
+            pos = pos.subspan(mk::serialize_binary(p, pos));
+        }
+        CHECK(pos.empty());
+
+        auto in = gsl::span<std::byte const>(bytes);
+        for (auto const& p : particles)
+        {
+            auto q = Particle{ };
+            in = in.subspan(mk::deserialize_binary(q, in));
+            CHECK(q.magic == p.magic);
+            CHECK(q.kind == p.kind);
+            CHECK(q.valid == p.valid);
+            CHECK(q.position.x == p.position.x);
+            CHECK(q.position.y == p.position.y);
+            CHECK(q.position.z == p.position.z);
+            CHECK(q.mass == p.mass);
+            CHECK(q.cell == p.cell);
+            CHECK(q.flags[0] == p.flags[0]);
+            CHECK(q.flags[2] == p.flags[2]);
+        }
+    }
+    SECTION("errors")
+    {
+        auto bytes = std::array<std::byte, 11>{ };
+        CHECK_THROWS_AS(mk::deserialize_binary<Vec3>(bytes), std::runtime_error);
+    }
+}
+
+TEST_CASE("record_view")
+{
+    static_assert(mk::record_view<COO>::is_zero_copy);
+    static_assert(mk::record_view<Vec3>::is_zero_copy);
+    static_assert(!mk::record_view<AltLayoutCOO>::is_zero_copy);  // members not reflected in declaration order
+    static_assert(!mk::record_view<PaddedCOO>::is_zero_copy);  // padding
+    static_assert(!mk::record_view<Header>::is_zero_copy);  // `bool` member
+    static_assert(!mk::record_view<Particle>::is_zero_copy);
+    static_assert(!mk::record_view<InitializedCOO>::is_zero_copy);  // not a literal type
+
+    auto vC = MAKESHIFT_CONSTVAL(std::string_view("v"));
+    auto jC = MAKESHIFT_CONSTVAL(std::string_view("j"));
+
+    alignas(8) auto bytes = std::array<std::byte, 3*16>{ };
+    auto pos = gsl::span<std::byte>(bytes);
+    for (int k = 0; k != 3; ++k)
+    {
+        pos = pos.subspan(mk::serialize_binary(COO{ k, 2*k, 0.5*k }, pos));
+    }
+
+    SECTION("in-place access")
+    {
+        auto records = mk::record_view<COO>(bytes);
+        CHECK(records.size() == 3);
+        CHECK(records[2].j == 4);
+        CHECK(records.records().data() == reinterpret_cast<COO const*>(bytes.data()));
+        CHECK(&records.member(1, vC) == &records.records()[1].v);
+        CHECK(records.member(1, vC) == 0.5);
+    }
+    SECTION("decoding access")
+    {
+        alignas(8) auto altBytes = std::array<std::byte, 2*16>{ };
+        auto altPos = gsl::span<std::byte>(altBytes);
+        altPos = altPos.subspan(mk::serialize_binary(AltLayoutCOO{ 1, 2, 1.5 }, altPos));
+        altPos = altPos.subspan(mk::serialize_binary(AltLayoutCOO{ 3, 4, 3.5 }, altPos));
+        CHECK(mk::deserialize_binary<double>(altBytes) == 1.5);  // encoded in reflection order: `v` first
+        auto records = mk::record_view<AltLayoutCOO>(altBytes);
+        CHECK(records.size() == 2);
+        AltLayoutCOO r = records[1];
+        CHECK(r.i == 3);
+        CHECK(r.j == 4);
+        CHECK(r.v == 3.5);
+        CHECK(records.member(0, jC) == 2);
+        CHECK(records.member(1, vC) == 3.5);
+
+        auto paddedBytes = std::array<std::byte, 2*12>{ };
+        auto paddedPos = gsl::span<std::byte>(paddedBytes);
+        paddedPos = paddedPos.subspan(mk::serialize_binary(PaddedCOO{ 1, 1.5 }, paddedPos));
+        paddedPos = paddedPos.subspan(mk::serialize_binary(PaddedCOO{ 2, 2.5 }, paddedPos));
+        auto paddedRecords = mk::record_view<PaddedCOO>(paddedBytes);
+        CHECK(paddedRecords[1].i == 2);
+        CHECK(paddedRecords.member(1, vC) == 2.5);
+
+        auto initializedBytes = std::array<std::byte, 16>{ };
+        mk::serialize_binary(InitializedCOO{ 1, 2, 1.5 }, initializedBytes);
+        auto initializedRecords = mk::record_view<InitializedCOO>(initializedBytes);
+        CHECK(initializedRecords[0].j == 2);
+        CHECK(initializedRecords.member(0, vC) == 1.5);
+    }
+    SECTION("errors")
+    {
+        CHECK_THROWS_AS(mk::record_view<COO>(gsl::span<std::byte const>(bytes).first(20)), std::runtime_error);
+    }
+}
+
+TEST_CASE("diff_members")
+{
+        // Members of `Particle`: magic, kind, valid, position, mass, cell, flags
+    static_assert(mk::patch_mask_size<Particle>() == 1);
+    static_assert(mk::max_patch_size<Particle>() == 1 + mk::binary_size<Particle>());
+
+    auto p = Particle{ };
+    p.magic = 42;
+    p.kind = Kind::a;
+    p.position = { 1.f, 2.f, 3.f };
+    p.mass = 1.5;
+    p.cell = { 1, 2 };
+
+    auto buffer = std::array<std::byte, mk::max_patch_size<Particle>()>{ };
+
+    SECTION("no changes")
+    {
+        CHECK(mk::diff_members(p, p, buffer) == 1);
+        CHECK(buffer[0] == std::byte(0));
+
+        auto q = p;
+        CHECK(mk::apply_patch(q, gsl::span<std::byte const>(buffer).first(1)) == 1);
+        CHECK(q.magic == 42);
+    }
+    SECTION("only changed members are encoded")
+    {
+        auto p2 = p;
+        p2.kind = Kind::b;
+        p2.position.y = -2.f;
+        std::size_t n = mk::diff_members(p, p2, buffer);
+        CHECK(n == 1 + 2 + 12);
+        CHECK(buffer[0] == std::byte(0b1010));
+        CHECK(buffer[1] == std::byte(0x02));
+        CHECK(buffer[2] == std::byte(0x01));
+
+        auto q = p;
+        CHECK(mk::apply_patch(q, gsl::span<std::byte const>(buffer).first(n)) == n);
+        CHECK(q.kind == Kind::b);
+        CHECK(q.position.x == 1.f);
+        CHECK(q.position.y == -2.f);
+        CHECK(q.magic == 42);
+        CHECK(q.mass == 1.5);
+    }
+    SECTION("encodings are compared")
+    {
+        auto c = COO{ 1, 2, 0. };
+        auto c2 = COO{ 1, 2, -0. };
+        CHECK(mk::diff_members(c, c, buffer) == 1);
+        CHECK(mk::diff_members(c, c2, buffer) == 1 + 8);
+        CHECK(buffer[0] == std::byte(0b100));
+
+        auto h = Header{ 1, Kind::a, false };
+        auto h2 = Header{ 1, Kind::a, true };
+        CHECK(mk::diff_members(h, h2, buffer) == 1 + 1);
+        CHECK(buffer[0] == std::byte(0b100));
+    }
+    SECTION("errors")
+    {
+        auto p2 = p;
+        p2.mass = 2.5;
+        p2.flags[1] = 1;
+        std::size_t n = mk::diff_members(p, p2, buffer);
+        CHECK(n == 1 + 8 + 3);
+
+        auto q = p;
+        CHECK_THROWS_AS(mk::apply_patch(q, gsl::span<std::byte const>(buffer).first(n - 1)), std::runtime_error);
+        CHECK(q.mass == 1.5);
+        CHECK_THROWS_AS(mk::apply_patch(q, gsl::span<std::byte const>{ }), std::runtime_error);
+
+        buffer[0] |= std::byte(0x80);  // `Particle` has only 7 members
+        CHECK_THROWS_AS(mk::apply_patch(q, gsl::span<std::byte const>(buffer)), std::runtime_error);
+        CHECK(q.mass == 1.5);
+    }
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,158 @@
+
+#include <makeshift/experimental/small_vector.hpp>
+#include <makeshift/experimental/memory.hpp>
+
+#include <memory>           // for unique_ptr<>, make_unique<>()
+#include <string>
+#include <vector>
+#include <cstddef>          // for size_t
+#include <utility>          // for move()
+#include <string_view>
+#include <memory_resource>  // for pmr::monotonic_buffer_resource, pmr::polymorphic_allocator<>
+
+#include <catch2/catch_test_macros.hpp>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+
+
+TEST_CASE("small_vector")
+{
+    SECTION("elements are stored in-place until the inline capacity is exceeded")
+    {
+        auto v = mk::small_vector<int, 4>{ };
+        CHECK(v.empty());
+        CHECK(v.capacity() == 4);
+        v.push_back(1);
+        v.push_back(2);
+        auto inlineData = v.data();
+        v.push_back(3);
+        v.push_back(4);
+        CHECK(v.data() == inlineData);
+        v.push_back(5);
+        CHECK(v.data() != inlineData);
+        CHECK(v.capacity() >= 8);
+        CHECK(v == mk::small_vector<int, 4>{ 1, 2, 3, 4, 5 });
+        for (int i = 6; i <= 100; ++i)
+        {
+            v.push_back(i);
+        }
+        CHECK(v.size() == 100);
+        CHECK(v.back() == 100);
+        CHECK(v[49] == 50);
+    }
+    SECTION("emplace_back(), pop_back(), resize(), reserve()")
+    {
+        auto v = mk::small_vector<std::string, 2>{ };
+        CHECK(v.emplace_back(3, 'x') == "xxx");
+        v.resize(5);
+        CHECK(v.size() == 5);
+        CHECK(v[4].empty());
+        v.resize(7, "abc");
+        CHECK(v[6] == "abc");
+        v.pop_back();
+        CHECK(v.size() == 6);
+        v.resize(1);
+        CHECK(v == mk::small_vector<std::string, 2>{ "xxx" });
+        v.reserve(64);
+        CHECK(v.capacity() == 64);
+        CHECK(v[0] == "xxx");
+        v.clear();
+        CHECK(v.empty());
+    }
+    SECTION("inserting an element of the vector itself")
+    {
+        auto v = mk::small_vector<std::string, 2>{ "abc", "def" };
+        v.push_back(v[0]);
+        CHECK(v[2] == "abc");
+        v.resize(10, v[1]);
+        CHECK(v[9] == "def");
+    }
+    SECTION("move-only elements")
+    {
+        auto v = mk::small_vector<std::unique_ptr<int>, 1>{ };
+        v.push_back(std::make_unique<int>(1));
+        v.push_back(std::make_unique<int>(2));
+        CHECK(*v[1] == 2);
+    }
+    SECTION("moving steals heap storage")
+    {
+        auto v = mk::small_vector<std::string, 2>{ "a", "b", "c" };
+        auto data = v.data();
+        auto v2 = std::move(v);
+        CHECK(v2.data() == data);
+        CHECK(v.empty());
+        CHECK(v.capacity() == 2);
+
+        auto small = mk::small_vector<std::string, 2>{ "a" };
+        auto small2 = std::move(small);
+        CHECK(small2 == mk::small_vector<std::string, 2>{ "a" });
+        CHECK(small.empty());
+
+        small2 = std::move(v2);
+        CHECK(small2.data() == data);
+        CHECK(small2.size() == 3);
+    }
+    SECTION("copying")
+    {
+        auto v = mk::small_vector<int, 2>{ 1, 2, 3 };
+        auto v2 = v;
+        CHECK(v2 == v);
+        CHECK(v2.data() != v.data());
+        auto v3 = mk::small_vector<int, 2>{ 4 };
+        v3 = v;
+        CHECK(v3 == v);
+        v3 = mk::small_vector<int, 2>{ 5 };
+        CHECK(v3 == mk::small_vector<int, 2>{ 5 });
+    }
+    SECTION("no in-place storage")
+    {
+        auto v = mk::small_vector<int, 0>{ };
+        CHECK(v.capacity() == 0);
+        v.push_back(1);
+        v.push_back(2);
+        CHECK(v == mk::small_vector<int, 0>{ 1, 2 });
+    }
+    SECTION("allocators")
+    {
+        auto arena = mk::monotonic_arena();
+        auto v = mk::small_vector<double, 4, mk::arena_allocator<double>>(mk::arena_allocator<double>(arena));
+        v.resize(10, 1.);
+        CHECK(v[9] == 1.);
+
+        auto resource1 = std::pmr::monotonic_buffer_resource();
+        auto resource2 = std::pmr::monotonic_buffer_resource();
+        using Vector = mk::small_vector<std::string, 1, std::pmr::polymorphic_allocator<std::string>>;
+        auto v1 = Vector({ "a", "b" }, &resource1);
+        auto v2 = Vector(&resource2);
+        v2 = std::move(v1);
+        CHECK(v2.get_allocator().resource() == &resource2);
+        CHECK(v2 == Vector({ "a", "b" }));
+
+            // Elements moved between vectors with unequal allocators are constructed with the allocator of the target.
+        using PmrVector = mk::small_vector<std::pmr::string, 2, std::pmr::polymorphic_allocator<std::pmr::string>>;
+        auto longString = std::string(100, 'x');
+        auto longStringView = std::string_view(longString);
+        for (std::size_t n : { 2, 3 })
+        {
+            auto v3 = PmrVector(&resource1);
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                v3.emplace_back(longString);
+            }
+            auto v4 = PmrVector(&resource2);
+            v4 = std::move(v3);
+            REQUIRE(v4.size() == n);
+            for (auto const& str : v4)
+            {
+                CHECK(str == longStringView);
+                CHECK(str.get_allocator().resource() == &resource2);
+            }
+        }
+    }
+}
+
+
+} // anonymous namespace
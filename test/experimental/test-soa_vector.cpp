@@ -0,0 +1,193 @@
+
+#include <makeshift/experimental/soa_vector.hpp>
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <utility>          // for move()
+#include <type_traits>      // for is_same<>
+#include <memory_resource>  // for pmr::monotonic_buffer_resource
+
+#include <gsl-lite/gsl-lite.hpp>  // for type_identity<>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "test-alignment.hpp"  // for is_aligned()
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+using test::is_aligned;
+
+
+struct COO { int i; int j; double v; };
+constexpr auto
+reflect(gsl::type_identity<COO>)
+{
+    return mk::value_tuple{ &COO::i, &COO::j, &COO::v };
+}
+
+struct Particle { double x; double v; int id; };
+constexpr auto
+reflect(gsl::type_identity<Particle>)
+{
+    return mk::make_value_tuple(
+        mk::value_tuple{ &Particle::x, "x" },
+        mk::value_tuple{ &Particle::v, "v" },
+        mk::value_tuple{ &Particle::id, "id" }
+    );
+}
+
+
+TEST_CASE("soa_vector")
+{
+    SECTION("push_back() and element access")
+    {
+        auto v = mk::soa_vector<int, std::string>{ };
+        CHECK(v.empty());
+        for (int k = 0; k != 100; ++k)
+        {
+            v.push_back({ k, std::to_string(k) });
+        }
+        CHECK(v.size() == 100);
+        CHECK(v.capacity() >= 100);
+        CHECK(std::get<1>(std::tuple<int, std::string>(v[42])) == "42");
+        using std::get;
+        CHECK(get<0>(v.back()) == 99);
+        CHECK(get<1>(v)[7] == "7");
+        v.pop_back();
+        CHECK(v.size() == 99);
+        CHECK(v.end() - v.begin() == 99);
+    }
+    SECTION("columns are aligned")
+    {
+        auto v = mk::soa_vector<char, double, short>(13);
+        using std::get;
+        CHECK(is_aligned(get<0>(v).data(), 64));
+        CHECK(is_aligned(get<1>(v).data(), 64));
+        CHECK(is_aligned(get<2>(v).data(), 64));
+        CHECK(get<1>(v)[12] == 0.);
+    }
+    SECTION("emplace_back() may refer to elements of the container")
+    {
+        auto v = mk::soa_vector<std::string, int>{ };
+        v.emplace_back("abc", 1);
+        for (int k = 0; k != 10; ++k)
+        {
+            using std::get;
+            v.emplace_back(get<0>(v.front()), k);
+        }
+        using std::get;
+        CHECK(get<0>(v[10]) == "abc");
+    }
+    SECTION("soa_span<> views")
+    {
+        auto v = mk::soa_vector<int, int, double>(5);
+        auto [is, js, vs] = v.span();
+        for (std::size_t k = 0; k != 5; ++k)
+        {
+            is[k] = int(k);
+            js[k] = int(2*k);
+        }
+        for (auto&& [i, j, val] : v)
+        {
+            val = i + j;
+        }
+        auto const& cv = v;
+        using std::get;
+        CHECK(get<2>(cv.span())[4] == 12.);
+        CHECK(get<2>(cv[3]) == 9.);
+    }
+    SECTION("resize(), copying, and moving")
+    {
+        auto v = mk::soa_vector<std::string, double>{ };
+        v.resize(3);
+        using std::get;
+        get<0>(v[2]) = "x";
+        auto v2 = v;
+        CHECK(v2 == v);
+        auto v3 = std::move(v2);
+        CHECK(v3 == v);
+        CHECK(v2.empty());
+        v2 = v3;
+        CHECK(v2 == v);
+        v.resize(1);
+        CHECK(v != v2);
+        v2 = std::move(v);
+        CHECK(v2.size() == 1);
+    }
+    SECTION("allocator")
+    {
+        auto resource1 = std::pmr::monotonic_buffer_resource();
+        auto resource2 = std::pmr::monotonic_buffer_resource();
+        auto v1 = mk::pmr::soa_vector<int, std::string>(&resource1);
+        v1.push_back({ 1, "a" });
+        auto v2 = mk::pmr::soa_vector<int, std::string>(&resource2);
+        v2 = std::move(v1);
+        CHECK(v2.get_allocator().resource() == &resource2);
+        using std::get;
+        CHECK(get<1>(v2[0]) == "a");
+    }
+    SECTION("column types of reflected structs")
+    {
+        static_assert(std::is_same<mk::soa_vector_for<COO>, mk::soa_vector<int, int, double>>::value, "static assertion failed");
+        auto coo = mk::soa_vector_for<COO>{ };
+        coo.emplace_back(1, 2, 3.);
+        CHECK(coo.size() == 1);
+    }
+}
+
+
+TEST_CASE("soa_of")
+{
+    SECTION("named member access")
+    {
+        auto particles = mk::soa_of<Particle>{ };
+        particles.push_back(Particle{ 1., 2., 42 });
+        particles.push_back(Particle{ 3., 4., 43 });
+        particles[1]->*&Particle::x += 0.5*(particles[1]->*&Particle::v);
+        CHECK(particles[1].member<&Particle::x>() == 5.);
+        Particle p = particles[1];
+        CHECK(p.id == 43);
+        particles[0] = Particle{ 7., 8., 44 };
+        auto xs = particles.column<&Particle::x>();
+        static_assert(std::is_same<decltype(xs), gsl::span<double>>::value, "static assertion failed");
+        CHECK(xs[0] == 7.);
+        auto const& cparticles = particles;
+        CHECK(cparticles.column<&Particle::id>()[0] == 44);
+        CHECK((cparticles[0]->*&Particle::v) == 8.);
+        auto [x, v, id] = particles[0];
+        CHECK(id == 44);
+        particles[1] = particles[0];
+        CHECK((particles[1]->*&Particle::x) == 7.);
+    }
+    SECTION("aos_to_soa() and soa_to_aos()")
+    {
+        auto aos = std::vector<COO>{ { 0, 1, 1. }, { 1, 2, 2. }, { 2, 0, 3. } };
+        auto soa = mk::aos_to_soa(gsl::span(aos));
+        static_assert(std::is_same<decltype(soa), mk::soa_of<COO>>::value, "static assertion failed");
+        CHECK(soa.size() == 3);
+        CHECK(soa.column<&COO::j>()[1] == 2);
+        CHECK(soa.column<&COO::v>()[2] == 3.);
+
+        for (auto&& [i, j, v] : soa)
+        {
+            v *= 2;
+        }
+        auto aos2 = std::vector<COO>(soa.size());
+        mk::soa_to_aos(soa.span(), gsl::span(aos2));
+        CHECK(aos2[2].i == 2);
+        CHECK(aos2[2].v == 6.);
+
+        auto soa2 = mk::soa_vector_for<COO>(aos.size());
+        mk::aos_to_soa(gsl::span<COO const>(aos), soa2.span());
+        using std::get;
+        CHECK(get<2>(soa2)[1] == 2.);
+    }
+}
+
+
+} // anonymous namespace
@@ -38,6 +38,17 @@ TEST_CASE("soa_span<>")
 
     auto d = s.end() - s.begin();
     CHECK(d == std::ptrdiff_t(n));
+
+        // Iterators do not refer to the span object they were obtained from.
+    auto it = s.subspan(40).begin();
+    auto last = s.subspan(40).end();
+    CHECK(last - it == 2);
+    CHECK(std::get<0>(std::tuple<int, unsigned>(*it)) == 40);
+    using std::get;
+    it += 1;
+    CHECK(&get<0>(*it) == &ivals[41]);
+    CHECK(&get<1>(it[-41]) == &uvals[0]);
+    CHECK(++it == last);
 }
 
 
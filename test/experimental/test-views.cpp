@@ -0,0 +1,112 @@
+
+#include <list>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+
+#include <makeshift/algorithm.hpp>
+#include <makeshift/experimental/views.hpp>
+
+#include <gsl-lite/gsl-lite.hpp> // for index, dim
+
+#include <catch2/catch_test_macros.hpp>
+
+
+namespace {
+
+namespace mk = ::makeshift;
+namespace gsl = ::gsl_lite;
+
+
+template <typename R>
+std::vector<std::decay_t<decltype(*std::declval<R const&>().begin())>>
+to_vector(R const& range)
+{
+    auto result = std::vector<std::decay_t<decltype(*range.begin())>>{ };
+    for (auto&& elem : range)
+    {
+        result.push_back(elem);
+    }
+    return result;
+}
+
+
+TEST_CASE("views")
+{
+    auto vec = std::vector<int>{ 1, 2, 3, 4, 5, 6, 7 };
+    auto list = std::list<int>{ 1, 2, 3, 4, 5, 6, 7 };
+
+    SECTION("iota_view()")
+    {
+        CHECK(to_vector(mk::iota_view(3)) == std::vector<gsl::index>{ 0, 1, 2 });
+        CHECK(to_vector(mk::iota_view(2, 4)) == std::vector<gsl::index>{ 2, 3 });
+        CHECK(mk::iota_view(2, 4).size() == 2);
+        static_assert(std::is_same<decltype(mk::take_view(mk::iota_view(10), 3)), mk::index_range>::value, "static assertion failed");
+        CHECK(to_vector(mk::drop_view(mk::take_view(mk::iota_view(10), 5), 2)) == std::vector<gsl::index>{ 2, 3, 4 });
+    }
+    SECTION("sub_view(), take_view(), drop_view()")
+    {
+        CHECK(to_vector(mk::sub_view(vec, 1, 3)) == std::vector<int>{ 2, 3 });
+        CHECK(to_vector(mk::take_view(list, 3)) == std::vector<int>{ 1, 2, 3 });
+        CHECK(to_vector(mk::take_view(vec, 42)) == vec);
+        CHECK(to_vector(mk::drop_view(list, 5)) == std::vector<int>{ 6, 7 });
+        CHECK(to_vector(mk::drop_view(vec, 42)).empty());
+        CHECK(mk::drop_view(vec, 5).size() == 2);
+
+        auto v = mk::drop_view(mk::take_view(mk::drop_view(vec, 1), 4), 2);
+        static_assert(std::is_same<decltype(v), mk::detail::sub_range<std::vector<int>&>>::value, "static assertion failed");
+        CHECK(to_vector(v) == std::vector<int>{ 4, 5 });
+        CHECK(v.size() == 2);
+    }
+    SECTION("transform_view()")
+    {
+        auto v = mk::transform_view(mk::transform_view(list, [](int i) { return 2*i; }), [](int i) { return i + 1; });
+        CHECK(to_vector(v) == std::vector<int>{ 3, 5, 7, 9, 11, 13, 15 });
+        CHECK(v.size() == 7);
+
+        auto r = mk::transform_view(vec, [](int& i) -> int& { return i; });
+        using It = decltype(r.begin());
+        static_assert(std::is_base_of<std::random_access_iterator_tag, std::iterator_traits<It>::iterator_category>::value, "static assertion failed");
+        *(r.begin() + 2) = 42;
+        CHECK(vec[2] == 42);
+    }
+    SECTION("filter_view()")
+    {
+        auto v = mk::filter_view(mk::filter_view(list, [](int i) { return i % 2 != 0; }), [](int i) { return i > 1; });
+        CHECK(to_vector(v) == std::vector<int>{ 3, 5, 7 });
+        auto last = v.end();
+        CHECK(*--last == 7);
+    }
+    SECTION("stride_view()")
+    {
+        CHECK(to_vector(mk::stride_view(vec, 3)) == std::vector<int>{ 1, 4, 7 });
+        CHECK(mk::stride_view(vec, 3).size() == 3);
+        auto v = mk::stride_view(mk::stride_view(list, 2), 2);
+        static_assert(std::is_same<decltype(v), mk::detail::stride_range<std::list<int>&>>::value, "static assertion failed");
+        CHECK(to_vector(v) == std::vector<int>{ 1, 5 });
+    }
+    SECTION("pipelines with range_zip() and range algorithms")
+    {
+        auto squares = mk::transform_view(mk::iota_view(gsl::dim(vec.size())), [](gsl::index i) { return int(i*i); });
+        auto sum = mk::range_transform_reduce(0, std::plus<>{ },
+            [](int x, int y) { return x*y; },
+            squares, mk::take_view(list, 7));
+        CHECK(sum == 0*1 + 1*2 + 4*3 + 9*4 + 16*5 + 25*6 + 36*7);
+
+        int n = 0;
+        for (auto&& [i, x] : mk::range_zip(mk::range_index, mk::stride_view(mk::drop_view(vec, 1), 2)))
+        {
+            CHECK(x == 2*i + 2);
+            ++n;
+        }
+        CHECK(n == 3);
+
+        auto pairs = mk::transform_view(mk::range_zip(vec, list), [](auto&& t) { return std::get<0>(t) + std::get<1>(t); });
+        CHECK(to_vector(pairs) == std::vector<int>{ 2, 4, 6, 8, 10, 12, 14 });
+
+        CHECK(mk::range_count_if([](int i) { return i > 2; }, mk::filter_view(vec, [](int i) { return i % 2 == 0; })) == 2);
+    }
+}
+
+
+} // anonymous namespace
@@ -1,9 +1,11 @@
 
 #include <list>
+#include <utility>
 #include <tuple>
 #include <array>
 #include <vector>
 #include <iterator>
+#include <functional>
 
 #include <makeshift/algorithm.hpp>
 
@@ -147,6 +149,131 @@ TEST_CASE("range_for()")
     }
 }
 
+TEST_CASE("range_for<Unroll>()")
+{
+    auto vec7 = std::vector<int>{ 1, 2, 3, 4, 5, 6, 7 };
+    auto list7 = std::list<int>{ 11, 12, 13, 14, 15, 16, 17 };
+
+    SECTION("random access")
+    {
+        auto indices = std::vector<gsl::index>{ };
+        mk::range_for<3>(
+            [&](gsl::index iv, int& vv)
+            {
+                CHECK(vv == iv + 1);
+                indices.push_back(iv);
+            },
+            mk::range_index, vec7);
+        CHECK(indices == std::vector<gsl::index>{ 0, 1, 2, 3, 4, 5, 6 });
+    }
+    SECTION("non-random access")
+    {
+        int i = 0;
+        mk::range_for<2>(
+            [&](gsl::index iv, int& vv, int& lv)
+            {
+                CHECK(iv == i);
+                CHECK(vv == i + 1);
+                CHECK(lv == i + 11);
+                ++i;
+            },
+            mk::range_index, vec7, list7);
+        CHECK(i == 7);
+    }
+    SECTION("reduction preserves order")
+    {
+        auto concat = [](std::vector<int> acc, int v) { acc.push_back(v); return acc; };
+        auto identity = [](int v) { return v; };
+        CHECK(mk::range_transform_reduce<4>(std::vector<int>{ }, concat, identity, vec7) == vec7);
+        CHECK(mk::range_transform_reduce<4>(std::vector<int>{ }, concat, identity, list7) == std::vector<int>(list7.begin(), list7.end()));
+        CHECK(mk::range_transform_reduce<8>(0, std::plus<>{ }, identity, vec7) == 28);
+    }
+}
+
+TEST_CASE("range_for_prefetch()")
+{
+    auto vec5 = std::vector<int>{ 1, 2, 3, 4, 5 };
+    auto list5 = std::list<int>{ 11, 12, 13, 14, 15 };
+
+    SECTION("basic use with index")
+    {
+        int i = 0;
+        mk::range_for_prefetch(
+            std::integral_constant<gsl::dim, 2>{ },
+            [&](gsl::index iv, int& vv, int& lv)
+            {
+                CHECK(iv == i);
+                CHECK(vv == i + 1);
+                CHECK(lv == i + 11);
+                ++i;
+            },
+            mk::range_index, vec5, list5);
+        CHECK(i == 5);
+    }
+    SECTION("distance exceeds size")
+    {
+        int i = 0;
+        mk::range_for_prefetch(
+            std::integral_constant<gsl::dim, 16>{ },
+            [&](int& vv) { vv = 0; ++i; },
+            vec5);
+        CHECK(i == 5);
+        CHECK(vec5 == std::vector<int>(5, 0));
+    }
+    SECTION("reduction")
+    {
+        auto sum = mk::range_transform_reduce_prefetch(
+            std::integral_constant<gsl::dim, 2>{ },
+            0,
+            std::plus<>{ },
+            [](int v, int l) { return v*l; },
+            vec5, list5);
+        CHECK(sum == 1*11 + 2*12 + 3*13 + 4*14 + 5*15);
+    }
+}
+
+TEST_CASE("range_for_tiled()")
+{
+    auto vec5 = std::vector<int>{ 1, 2, 3, 4, 5 };
+    auto list5 = std::list<int>{ 11, 12, 13, 14, 15 };
+    auto arr4 = std::array<int, 4>{ 21, 22, 23, 24 };
+
+    SECTION("procedures are called tile by tile")
+    {
+        auto calls = std::vector<std::pair<int, gsl::index>>{ };
+        mk::range_for_tiled(
+            std::integral_constant<gsl::dim, 2>{ },
+            [&](gsl::index i, int&, int&) { calls.emplace_back(0, i); },
+            [&](gsl::index i, int&, int&) { calls.emplace_back(1, i); },
+            mk::range_index, vec5, list5);
+        auto expectedCalls = std::vector<std::pair<int, gsl::index>>{
+            { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 },
+            { 0, 2 }, { 0, 3 }, { 1, 2 }, { 1, 3 },
+            { 0, 4 }, { 1, 4 }
+        };
+        CHECK(calls == expectedCalls);
+    }
+    SECTION("chained kernels")
+    {
+        mk::range_for_tiled(
+            std::integral_constant<gsl::dim, 3>{ },
+            [](int& v, int l) { v += l; },
+            [](int& v, int& l) { l = 2*v; },
+            vec5, list5);
+        CHECK(vec5 == std::vector<int>{ 12, 14, 16, 18, 20 });
+        CHECK(list5 == std::list<int>{ 24, 28, 32, 36, 40 });
+    }
+    SECTION("static size")
+    {
+        int n = 0;
+        mk::range_for_tiled(
+            std::integral_constant<gsl::dim, 4>{ },
+            [&](gsl::index i, int a) { CHECK(a == i + 21); ++n; },
+            mk::range_index, arr4);
+        CHECK(n == 4);
+    }
+}
+
 // TODO: add more tests
 
 
@@ -1,5 +1,7 @@
 
+#include <array>
 #include <tuple>
+#include <cstddef>  // for size_t
 #include <optional>
 #include <string_view>
 #include <type_traits>
@@ -211,6 +213,33 @@ reflect(gsl::type_identity<AltLayoutCOO1>)
     );
 }
 
+constexpr std::size_t numGeneratedNames = 1000;
+constexpr auto
+generateNameChars()
+{
+    auto result = std::array<char, 4*numGeneratedNames>{ };
+    for (std::size_t i = 0; i != numGeneratedNames; ++i)
+    {
+        result[4*i] = 'n';
+        result[4*i + 1] = char('0' + i/100);
+        result[4*i + 2] = char('0' + i/10%10);
+        result[4*i + 3] = char('0' + i%10);
+    }
+    return result;
+}
+constexpr auto generatedNameChars = generateNameChars();
+constexpr auto
+generateNames()
+{
+    auto result = std::array<std::string_view, numGeneratedNames>{ };
+    for (std::size_t i = 0; i != numGeneratedNames; ++i)
+    {
+        result[i] = std::string_view(generatedNameChars.data() + 4*i, 4);
+    }
+    return result;
+}
+constexpr auto generatedNames = generateNames();
+
 
 TEST_CASE("enum metadata")
 {
@@ -337,6 +366,60 @@ TEST_CASE("struct metadata")
     CHECK(mk::metadata::members<mk::value_tuple, SubCOO2>() == mk::value_tuple{ &COO4::i, &COO4::j, &COO4::v, &SubCOO2::v2 });
     CHECK(mk::metadata::member_names<SubCOO2>() == std::array{ "i"sv, "j"sv, "v"sv, "v2"sv });
 
+    SECTION("lookup by name")
+    {
+        static_assert(mk::metadata::search_member_index_by_name<SubCOO2>("v2") == 3);
+        static_assert(mk::metadata::search_member_index_by_name<SubCOO2>("w") == -1);
+        static_assert(mk::metadata::search_exclusive_member_index_by_name<SubCOO2>("v2") == 0);
+        static_assert(mk::metadata::search_exclusive_member_index_by_name<SubCOO2>("i") == -1);
+        static_assert(mk::metadata::search_value_index_by_name<Color5>("green") == 1);
+        static_assert(mk::metadata::search_value_index_by_name<Color5>("blue") == -1);
+        static_assert(mk::detail::member_name_hash_index_v<SubCOO2, mk::reflector>.is_perfect);
+        static_assert(mk::detail::exclusive_member_name_hash_index_v<SubCOO2, mk::reflector>.is_perfect);
+        static_assert(mk::detail::value_name_hash_index_v<Color5, mk::reflector>.is_perfect);
+        for (auto name : mk::metadata::member_names<SubCOO2>())
+        {
+            CHECK(mk::metadata::member_names<SubCOO2>()[mk::metadata::find_member_index_by_name<SubCOO2>(name)] == name);
+        }
+        CHECK(mk::metadata::search_member_index_by_name<SubCOO2>(""sv) == -1);
+        CHECK(mk::metadata::search_member_index_by_name<SubCOO2>("v22"sv) == -1);
+    }
+    SECTION("lookup in large name set")
+    {
+        static constexpr auto index = mk::detail::make_name_hash_index(generatedNames);
+        static_assert(index.is_perfect);
+        static_assert(index.search("n000") == 0);
+        static_assert(index.search("n999") == 999);
+        static_assert(index.search("n1000") == -1);
+        for (std::size_t i = 0; i != numGeneratedNames; ++i)
+        {
+            CHECK(index.search(generatedNames[i]) == gsl::index(i));
+        }
+        CHECK(index.search("m000"sv) == -1);
+    }
+    SECTION("visit_member_by_name()")
+    {
+        SubCOO2 sc2{ COO4{ 1, 2, 3. }, 4. };
+        CHECK(mk::metadata::visit_member_by_name(sc2, "j", [](auto& member) { member += 40; }));
+        CHECK(mk::metadata::visit_member_by_name(sc2, "v2", [](auto& member) { member *= 2; }));
+        CHECK_FALSE(mk::metadata::visit_member_by_name(sc2, "w", [](auto&) { CHECK(false); }));
+        CHECK(sc2.j == 42);
+        CHECK(sc2.v2 == 8.);
+
+        SubCOO2 const& csc2 = sc2;
+        double sum = 0.;
+        for (auto name : { "i", "j", "v", "v2" })
+        {
+            mk::metadata::visit_member_by_name(csc2, name,
+                [&sum](auto& member)
+                {
+                    static_assert(std::is_const_v<std::remove_reference_t<decltype(member)>>);
+                    sum += member;
+                });
+        }
+        CHECK(sum == 1 + 42 + 3. + 8.);
+    }
+
 #if gsl_CPP20_OR_GREATER
     SECTION("tie_members()")
     {